@@ -0,0 +1,111 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Headless benchmark for one processor, see ProcessorBenchmark.h.
+
+    Usage:
+      <Processor>_Benchmark [--block-sizes=16,64,512] [--sample-rates=44100,96000]
+                            [--channels=1,2] [--seconds=0.5] [--steps=3]
+                            [--channel-packing=auto,planar,packed]
+                            [--sweep=drive,model] [--set=model=Tanh,trim=-6]
+                            [--all-combinations] [--max-combinations=256]
+                            [--format=json|csv] [--output=file]
+
+    Parameters are swept one at a time from their defaults. --sweep limits that
+    to the IDs listed, --set holds parameters at a value (as the host shows it)
+    and --all-combinations runs every combination of the swept ones instead,
+    up to --max-combinations.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "ProcessorBenchmark.h"
+
+//Defined by the processor library this executable is linked against
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+template <typename Type>
+static juce::Array<Type> parseList(const juce::String& text)
+{
+    juce::Array<Type> values;
+
+    for (auto& token : juce::StringArray::fromTokens(text, ",", ""))
+        if (token.trim().isNotEmpty())
+            values.add(static_cast<Type>(token.trim().getDoubleValue()));
+
+    return values;
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h")) {
+        std::cout << "Usage: " << args.executableName.toStdString()
+                  << " [--block-sizes=16,64,512] [--sample-rates=44100,96000] [--channels=1,2]"
+                     " [--seconds=0.5] [--steps=3] [--channel-packing=auto,planar,packed]"
+                     " [--sweep=drive,model] [--set=model=Tanh,trim=-6] [--all-combinations] [--max-combinations=256]"
+                     " [--format=json|csv] [--output=file]" << std::endl;
+        return 0;
+    }
+
+    BenchmarkSettings settings;
+
+    if (args.containsOption("--block-sizes"))
+        settings.blockSizes = parseList<int>(args.getValueForOption("--block-sizes"));
+
+    if (args.containsOption("--sample-rates"))
+        settings.sampleRates = parseList<double>(args.getValueForOption("--sample-rates"));
+
+    if (args.containsOption("--channels"))
+        settings.channelCounts = parseList<int>(args.getValueForOption("--channels"));
+
+    if (args.containsOption("--channel-packing"))
+        settings.channelPackings = juce::StringArray::fromTokens(args.getValueForOption("--channel-packing"), ",", "");
+
+    if (args.containsOption("--seconds"))
+        settings.secondsPerRun = args.getValueForOption("--seconds").getDoubleValue();
+
+    if (args.containsOption("--steps"))
+        settings.continuousParameterSteps = args.getValueForOption("--steps").getIntValue();
+
+    if (args.containsOption("--sweep"))
+        settings.sweptParameters = juce::StringArray::fromTokens(args.getValueForOption("--sweep"), ",", "");
+
+    if (args.containsOption("--set")) {
+        for (auto& token : juce::StringArray::fromTokens(args.getValueForOption("--set"), ",", ""))
+            if (token.contains("="))
+                settings.fixedParameters.set(token.upToFirstOccurrenceOf("=", false, false).trim(),
+                                             token.fromFirstOccurrenceOf("=", false, false).trim());
+    }
+
+    settings.allCombinations = args.containsOption("--all-combinations");
+
+    if (args.containsOption("--max-combinations"))
+        settings.maxCombinations = args.getValueForOption("--max-combinations").getIntValue();
+
+    ProcessorBenchmark benchmark([] { return std::unique_ptr<juce::AudioProcessor>(createPluginFilter()); }, settings);
+
+    auto results = benchmark.run([] (const BenchmarkResult& result) {
+        std::cerr << result.sampleRate << " Hz, " << result.blockSize << " samples, "
+                  << result.numChannels << " ch, " << result.channelPacking << ": " << result.nsPerSample << " ns/sample" << std::endl;
+    });
+
+    auto report = args.getValueForOption("--format") == "csv" ? ProcessorBenchmark::toCsv(results)
+                                                              : ProcessorBenchmark::toJson(results);
+
+    if (args.containsOption("--output")) {
+        if (! args.getFileForOption("--output").replaceWithText(report)) {
+            std::cerr << "Couldn't write " << args.getValueForOption("--output").toStdString() << std::endl;
+            return 1;
+        }
+    } else {
+        std::cout << report.toStdString() << std::endl;
+    }
+
+    return 0;
+}
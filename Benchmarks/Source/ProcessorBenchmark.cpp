@@ -0,0 +1,307 @@
+/*
+  ==============================================================================
+
+    ProcessorBenchmark.cpp
+
+  ==============================================================================
+*/
+
+#include "ProcessorBenchmark.h"
+#include "../../ViatorDSP/DistortionEngine.h"
+
+static ViatorDSP::DistortionEngine::ChannelPacking parseChannelPacking(const juce::String& name)
+{
+    if (name == "planar")
+        return ViatorDSP::DistortionEngine::ChannelPacking::planar;
+
+    if (name == "packed")
+        return ViatorDSP::DistortionEngine::ChannelPacking::packed;
+
+    return ViatorDSP::DistortionEngine::ChannelPacking::automatic;
+}
+
+ProcessorBenchmark::ProcessorBenchmark(ProcessorFactory factoryToUse, BenchmarkSettings settingsToUse)
+: factory(std::move(factoryToUse)), settings(std::move(settingsToUse))
+{
+}
+
+juce::Array<BenchmarkResult> ProcessorBenchmark::run(std::function<void(const BenchmarkResult&)> onResult)
+{
+    juce::Array<BenchmarkResult> results;
+    auto processor = factory();
+    auto& parameters = processor->getParameters();
+    auto parameterSettings = getParameterSettings(*processor);
+
+    juce::Random random(1234);
+
+    auto initialPacking = ViatorDSP::DistortionEngine::getChannelPacking();
+
+    for (auto& channelPacking : settings.channelPackings) {
+        //Global to the process, every ChannelPacker reads it as it runs
+        ViatorDSP::DistortionEngine::setChannelPacking(parseChannelPacking(channelPacking));
+
+        for (auto sampleRate : settings.sampleRates) {
+            for (auto numChannels : settings.channelCounts) {
+
+                //One second of a low sine with some noise on top, long enough for the biggest block
+                sourceSignal.setSize(numChannels, juce::jmax(static_cast<int>(sampleRate), settings.blockSizes.isEmpty() ? 0 : settings.blockSizes.getLast()));
+
+                for (int channel = 0; channel < numChannels; ++channel) {
+                    auto* data = sourceSignal.getWritePointer(channel);
+
+                    for (int sample = 0; sample < sourceSignal.getNumSamples(); ++sample) {
+                        auto phase = juce::MathConstants<double>::twoPi * 110.0 * sample / sampleRate;
+                        data[sample] = 0.5f * static_cast<float>(std::sin(phase)) + 0.05f * (random.nextFloat() * 2.0f - 1.0f);
+                    }
+                }
+
+                for (auto blockSize : settings.blockSizes) {
+                    for (auto& setting : parameterSettings) {
+
+                        BenchmarkResult result;
+
+                        for (int index = 0; index < parameters.size(); ++index) {
+                            auto* parameter = parameters[index];
+                            auto value = setting[index];
+
+                            parameter->setValueNotifyingHost(value);
+                            result.parameters.set(getParameterId(*parameter), parameter->getText(value, 32));
+                        }
+
+                        if (! configure(*processor, sampleRate, blockSize, numChannels))
+                            continue;
+
+                        auto measured = measure(*processor, sampleRate, blockSize, numChannels);
+                        measured.parameters = result.parameters;
+                        measured.processorName = processor->getName();
+                        measured.channelPacking = channelPacking;
+
+                        if (onResult != nullptr)
+                            onResult(measured);
+
+                        results.add(measured);
+                    }
+                }
+            }
+        }
+    }
+
+    ViatorDSP::DistortionEngine::setChannelPacking(initialPacking);
+    processor->releaseResources();
+    return results;
+}
+
+juce::Array<juce::Array<float>> ProcessorBenchmark::getParameterValues(juce::AudioProcessor& processor) const
+{
+    juce::Array<juce::Array<float>> allValues;
+
+    for (auto* parameter : processor.getParameters()) {
+        juce::Array<float> values;
+        auto id = getParameterId(*parameter);
+        int numSteps = parameter->isDiscrete() ? juce::jmin(parameter->getNumSteps(), 64) : settings.continuousParameterSteps;
+
+        if (settings.fixedParameters.containsKey(id)) {
+            values.add(parameter->getValueForText(settings.fixedParameters[id]));
+        } else if (numSteps <= 1 || ! (settings.sweptParameters.isEmpty() || settings.sweptParameters.contains(id))) {
+            values.add(parameter->getDefaultValue());
+        } else {
+            for (int step = 0; step < numSteps; ++step)
+                values.add(static_cast<float>(step) / static_cast<float>(numSteps - 1));
+        }
+
+        allValues.add(values);
+    }
+
+    return allValues;
+}
+
+juce::Array<juce::Array<float>> ProcessorBenchmark::getParameterSettings(juce::AudioProcessor& processor) const
+{
+    auto parameterValues = getParameterValues(processor);
+    auto& parameters = processor.getParameters();
+    juce::Array<juce::Array<float>> parameterSettings;
+
+    //Where every parameter sits when it isn't the one being swept
+    juce::Array<float> base;
+
+    for (int index = 0; index < parameters.size(); ++index) {
+        auto& values = parameterValues.getReference(index);
+        base.add(values.size() == 1 ? values.getFirst() : parameters[index]->getDefaultValue());
+    }
+
+    if (settings.allCombinations) {
+        //Each parameter is one digit of a mixed radix counter, counted in doubles so it can't overflow
+        double numCombinations = 1.0;
+
+        for (auto& values : parameterValues)
+            numCombinations *= values.size();
+
+        if (numCombinations > settings.maxCombinations) {
+            juce::Logger::writeToLog("Warning: " + juce::String(numCombinations, 0) + " parameter combinations, only the first "
+                                     + juce::String(settings.maxCombinations) + " run. Narrow them down with --sweep or --set");
+        }
+
+        auto numToRun = static_cast<int>(juce::jmin(numCombinations, static_cast<double>(settings.maxCombinations)));
+
+        for (int combination = 0; combination < numToRun; ++combination) {
+            juce::Array<float> setting;
+            int remainder = combination;
+
+            for (auto& values : parameterValues) {
+                setting.add(values[remainder % values.size()]);
+                remainder /= values.size();
+            }
+
+            parameterSettings.add(setting);
+        }
+
+        return parameterSettings;
+    }
+
+    //The base once, then each parameter through its other values with the rest left at the base
+    parameterSettings.add(base);
+
+    for (int index = 0; index < parameters.size(); ++index) {
+        for (auto value : parameterValues.getReference(index)) {
+            if (value == base[index])
+                continue;
+
+            auto setting = base;
+            setting.set(index, value);
+            parameterSettings.add(setting);
+        }
+    }
+
+    return parameterSettings;
+}
+
+juce::String ProcessorBenchmark::getParameterId(juce::AudioProcessorParameter& parameter)
+{
+    auto* parameterWithId = dynamic_cast<juce::AudioProcessorParameterWithID*>(&parameter);
+    return parameterWithId != nullptr ? parameterWithId->paramID : parameter.getName(64);
+}
+
+bool ProcessorBenchmark::configure(juce::AudioProcessor& processor, double sampleRate, int blockSize, int numChannels)
+{
+    processor.releaseResources();
+
+    auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+    juce::AudioProcessor::BusesLayout layout;
+    layout.inputBuses.add(channelSet);
+    layout.outputBuses.add(channelSet);
+
+    if (! processor.setBusesLayout(layout))
+        return false;
+
+    processor.setRateAndBufferSizeDetails(sampleRate, blockSize);
+    processor.prepareToPlay(sampleRate, blockSize);
+    return true;
+}
+
+BenchmarkResult ProcessorBenchmark::measure(juce::AudioProcessor& processor, double sampleRate, int blockSize, int numChannels)
+{
+    int numBlocks = juce::jmax(1, juce::roundToInt(settings.secondsPerRun * sampleRate / blockSize));
+
+    juce::AudioBuffer<float> buffer(numChannels, blockSize);
+    juce::MidiBuffer midiMessages;
+    int sourcePosition = 0;
+
+    blockTimes.clear();
+    blockTimes.reserve(static_cast<size_t>(numBlocks));
+
+    for (int block = 0; block < settings.warmupBlocks + numBlocks; ++block) {
+
+        //Refill from the source so every block sees fresh signal, this isn't timed
+        if (sourcePosition + blockSize > sourceSignal.getNumSamples())
+            sourcePosition = 0;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            buffer.copyFrom(channel, 0, sourceSignal, channel, sourcePosition, blockSize);
+
+        sourcePosition += blockSize;
+
+        auto start = juce::Time::getHighResolutionTicks();
+        processor.processBlock(buffer, midiMessages);
+        auto elapsed = juce::Time::getHighResolutionTicks() - start;
+
+        if (block >= settings.warmupBlocks)
+            blockTimes.push_back(juce::Time::highResolutionTicksToSeconds(elapsed) * 1.0e9);
+    }
+
+    BenchmarkResult result;
+    result.sampleRate = sampleRate;
+    result.blockSize = blockSize;
+    result.numChannels = numChannels;
+
+    double totalNs = 0.0;
+    for (auto time : blockTimes)
+        totalNs += time;
+
+    std::sort(blockTimes.begin(), blockTimes.end());
+
+    auto p99Index = static_cast<size_t>(std::ceil(0.99 * static_cast<double>(blockTimes.size()))) - 1;
+    auto audioNs = 1.0e9 * numBlocks * blockSize / sampleRate;
+
+    result.nsPerSample = totalNs / (static_cast<double>(numBlocks) * blockSize);
+    result.realTimeFactor = totalNs > 0.0 ? audioNs / totalNs : 0.0;
+    result.meanBlockNs = totalNs / numBlocks;
+    result.p99BlockNs = blockTimes[p99Index];
+    result.maxBlockNs = blockTimes.back();
+
+    return result;
+}
+
+juce::String ProcessorBenchmark::toJson(const juce::Array<BenchmarkResult>& results)
+{
+    juce::Array<juce::var> list;
+
+    for (auto& result : results) {
+        auto* parameters = new juce::DynamicObject();
+
+        for (auto& key : result.parameters.getAllKeys())
+            parameters->setProperty(key, result.parameters[key]);
+
+        auto* object = new juce::DynamicObject();
+        object->setProperty("processor", result.processorName);
+        object->setProperty("sampleRate", result.sampleRate);
+        object->setProperty("blockSize", result.blockSize);
+        object->setProperty("channels", result.numChannels);
+        object->setProperty("channelPacking", result.channelPacking);
+        object->setProperty("parameters", juce::var(parameters));
+        object->setProperty("nsPerSample", result.nsPerSample);
+        object->setProperty("realTimeFactor", result.realTimeFactor);
+        object->setProperty("meanBlockNs", result.meanBlockNs);
+        object->setProperty("p99BlockNs", result.p99BlockNs);
+        object->setProperty("maxBlockNs", result.maxBlockNs);
+
+        list.add(juce::var(object));
+    }
+
+    return juce::JSON::toString(juce::var(list));
+}
+
+juce::String ProcessorBenchmark::toCsv(const juce::Array<BenchmarkResult>& results)
+{
+    juce::String csv = "processor,sampleRate,blockSize,channels,channelPacking,parameters,nsPerSample,realTimeFactor,meanBlockNs,p99BlockNs,maxBlockNs\n";
+
+    for (auto& result : results) {
+        juce::StringArray parameters;
+
+        for (auto& key : result.parameters.getAllKeys())
+            parameters.add(key + "=" + result.parameters[key]);
+
+        csv << result.processorName << ","
+            << result.sampleRate << ","
+            << result.blockSize << ","
+            << result.numChannels << ","
+            << result.channelPacking << ","
+            << parameters.joinIntoString(";").quoted() << ","
+            << result.nsPerSample << ","
+            << result.realTimeFactor << ","
+            << result.meanBlockNs << ","
+            << result.p99BlockNs << ","
+            << result.maxBlockNs << "\n";
+    }
+
+    return csv;
+}
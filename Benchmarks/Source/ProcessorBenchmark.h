@@ -0,0 +1,102 @@
+/*
+  ==============================================================================
+
+    ProcessorBenchmark.h
+
+    Drives an AudioProcessor headlessly through prepareToPlay/processBlock and
+    times every block, for each combination of sample rate, block size,
+    channel count, parameter setting and channel packing.
+
+    Parameters are swept one at a time from their defaults unless asked for
+    every combination: the Saturator alone has tens of thousands of those,
+    each prepared afresh under every rate, block size and channel count.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+struct BenchmarkSettings
+{
+    juce::Array<int> blockSizes { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+    juce::Array<double> sampleRates { 44100.0, 48000.0, 96000.0, 192000.0 };
+    juce::Array<int> channelCounts { 1, 2 };
+
+    //DistortionEngine channel packing, "auto", "planar" or "packed". Running all
+    //three shows whether automatic picks the faster of the other two
+    juce::StringArray channelPackings { "auto" };
+
+    //Continuous parameters are sampled at this many evenly spaced points,
+    //discrete ones (models, switches) at every step
+    int continuousParameterSteps = 3;
+
+    //Parameter IDs to sweep, empty for all of them. The rest stay at their defaults
+    //or at what fixedParameters holds them to (ID to value as text, e.g. model=Tanh)
+    juce::StringArray sweptParameters;
+    juce::StringPairArray fixedParameters;
+
+    //Every combination of the swept parameters rather than one at a time. Past
+    //maxCombinations only the first that many run, with a warning
+    bool allCombinations = false;
+    int maxCombinations = 256;
+
+    //Length of audio pushed through each configuration. The warmup covers the
+    //blocks automatic channel packing spends timing both layouts
+    double secondsPerRun = 0.5;
+    int warmupBlocks = 32;
+};
+
+struct BenchmarkResult
+{
+    juce::String processorName;
+    double sampleRate = 0.0;
+    int blockSize = 0;
+    int numChannels = 0;
+    juce::String channelPacking;
+    juce::StringPairArray parameters;
+
+    //Per sample frame, i.e. all channels of one sample index
+    double nsPerSample = 0.0;
+
+    //Seconds of audio processed per second of CPU, above 1 is faster than real time
+    double realTimeFactor = 0.0;
+
+    double meanBlockNs = 0.0;
+    double p99BlockNs = 0.0;
+    double maxBlockNs = 0.0;
+};
+
+class ProcessorBenchmark
+{
+public:
+    using ProcessorFactory = std::function<std::unique_ptr<juce::AudioProcessor>()>;
+
+    ProcessorBenchmark(ProcessorFactory factory, BenchmarkSettings settings);
+
+    //Runs every configuration, onResult is called as each one finishes
+    juce::Array<BenchmarkResult> run(std::function<void(const BenchmarkResult&)> onResult = nullptr);
+
+    static juce::String toJson(const juce::Array<BenchmarkResult>& results);
+    static juce::String toCsv(const juce::Array<BenchmarkResult>& results);
+
+private:
+
+    //The normalised values each parameter is swept through, a single value for those that aren't swept
+    juce::Array<juce::Array<float>> getParameterValues(juce::AudioProcessor& processor) const;
+
+    //One normalised value per parameter for every setting to run
+    juce::Array<juce::Array<float>> getParameterSettings(juce::AudioProcessor& processor) const;
+
+    static juce::String getParameterId(juce::AudioProcessorParameter& parameter);
+
+    bool configure(juce::AudioProcessor& processor, double sampleRate, int blockSize, int numChannels);
+    BenchmarkResult measure(juce::AudioProcessor& processor, double sampleRate, int blockSize, int numChannels);
+
+    ProcessorFactory factory;
+    BenchmarkSettings settings;
+
+    juce::AudioBuffer<float> sourceSignal;
+    std::vector<double> blockTimes;
+};
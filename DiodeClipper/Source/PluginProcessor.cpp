@@ -23,6 +23,7 @@ DiodeClipperAudioProcessor::DiodeClipperAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 DiodeClipperAudioProcessor::~DiodeClipperAudioProcessor()
@@ -113,12 +114,20 @@ void DiodeClipperAudioProcessor::changeProgramName (int index, const juce::Strin
 //==============================================================================
 void DiodeClipperAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    meter.prepare(sampleRate);
+    
     juce::dsp::ProcessSpec spec;
     spec.maximumBlockSize = samplesPerBlock;
     spec.sampleRate = sampleRate;
     spec.numChannels = getTotalNumOutputChannels();
     
     outputGainProcessor.prepare(spec);
+    
+    //Built on first use, make sure that isn't the audio thread
+    ViatorDSP::DistortionEngine::Diode::getTable();
+    
+    channelPacker.prepare(getTotalNumInputChannels(), samplesPerBlock);
+    silenceDetector.reset();
 }
 
 void DiodeClipperAudioProcessor::releaseResources()
@@ -152,26 +161,52 @@ bool DiodeClipperAudioProcessor::isBusesLayoutSupported (const BusesLayout& layo
 #endif
 
 void DiodeClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void DiodeClipperAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool DiodeClipperAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void DiodeClipperAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
+    
+    //Silent in, and silent out last time, so there's nothing to shape
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        buffer.clear();
+        return;
+    }
 
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    {
-        auto* outputData = buffer.getWritePointer (channel);
-        auto* inputData = buffer.getReadPointer(channel);
-        auto* rawThermalVoltage = treeState.getRawParameterValue(thermalVoltageSliderId);
-        auto* rawEmissionCoefficient = treeState.getRawParameterValue(emissionCoefficientSliderId);
-        auto* rawSaturationCurrent = treeState.getRawParameterValue(saturationCurrentSliderId);
-
-        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-            outputData[sample] = exp(inputData[sample] / (0.0253 * 1.68)) - 1;
-        }
+    //exp(x / (n * Vt)) - 1 at the default thermal voltage and emission coefficient. The knobs
+    //aren't wired to the curve yet. The input is clamped to +-0.5 as before, inside the engine's own range
+    ViatorDSP::DistortionEngine::Coefficients coefficients;
+    coefficients.inputGain = 1.0 / (0.0253 * 1.68);
+    
+    for (int channel = 0; channel < totalNumInputChannels; ++channel) {
+        auto* data = buffer.getWritePointer(channel);
+        juce::FloatVectorOperations::clip(data, data, static_cast<SampleType>(-maxInput), static_cast<SampleType>(maxInput), buffer.getNumSamples());
     }
+    
+    juce::dsp::AudioBlock<SampleType> audioBlock (buffer);
+    auto inputChannels = audioBlock.getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+    channelPacker.process<ViatorDSP::DistortionEngine::Diode>(inputChannels, coefficients, static_cast<SampleType>(1), static_cast<SampleType>(0));
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //Saturation Current = 1;
@@ -9,6 +9,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../../ViatorDSP/DistortionEngine.h"
+#include "../../ViatorDSP/SilenceDetector.h"
+#include "../../ViatorDSP/ProcessorMeter.h"
 
 #define thermalVoltageSliderId "thermalVoltage"
 #define thermalVoltageSliderName "Thermal Voltage"
@@ -38,6 +41,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -63,9 +68,28 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
     
     juce::AudioProcessorValueTreeState treeState;
+    
+    //Block timing, read by the CSV log
+    ViatorDSP::ProcessorMeter meter;
 
 private:
     
+    //The curve has always been clamped here, +-11.8 into the exp at the default gain
+    static constexpr double maxInput = 0.5;
+    
+    //Only when VIATOR_METER_LOG is set
+    std::unique_ptr<ViatorDSP::ProcessorMeterLogger> meterLogger;
+    
+    //Both processBlock overloads, the same code in float or double
+    template <typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer);
+    
+    //Packs the channels into SIMD lanes when that's faster than running them one at a time
+    ViatorDSP::DistortionEngine::ChannelPacker channelPacker;
+    
+    //Skips the shaping once the input, and what came out of it, has gone silent
+    ViatorDSP::SilenceDetector silenceDetector;
+    
     juce::dsp::Gain<float> outputGainProcessor;
     
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
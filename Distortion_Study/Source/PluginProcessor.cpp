@@ -23,6 +23,7 @@ Distortion_StudyAudioProcessor::Distortion_StudyAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 Distortion_StudyAudioProcessor::~Distortion_StudyAudioProcessor()
@@ -113,14 +114,39 @@ void Distortion_StudyAudioProcessor::changeProgramName (int index, const juce::S
 //==============================================================================
 void Distortion_StudyAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    meter.prepare(sampleRate);
+    
     juce::dsp::ProcessSpec spec;
     spec.maximumBlockSize = samplesPerBlock;
     spec.sampleRate = sampleRate;
     spec.numChannels = getTotalNumOutputChannels();
     
-    distortionProcessor.prepare(spec);
-    distortionProcessor.get<1>().setRampDurationSeconds(1.0f);
-    distortionProcessor.get<2>().functionToUse = juce::dsp::FastMathApproximations::tanh;
+    if (isUsingDoublePrecision()) {
+        prepareDistortionProcessor<double>(spec);
+    } else {
+        prepareDistortionProcessor<float>(spec);
+    }
+    
+    silenceDetector.reset();
+}
+
+template <typename SampleType>
+Distortion_StudyAudioProcessor::DistortionChain<SampleType>& Distortion_StudyAudioProcessor::getDistortionProcessor()
+{
+    if constexpr (std::is_same<SampleType, float>::value) {
+        return distortionProcessor;
+    } else {
+        return doubleDistortionProcessor;
+    }
+}
+
+template <typename SampleType>
+void Distortion_StudyAudioProcessor::prepareDistortionProcessor(const juce::dsp::ProcessSpec& spec)
+{
+    auto& chain = getDistortionProcessor<SampleType>();
+    
+    chain.prepare(spec);
+    chain.template get<1>().setRampDurationSeconds(1.0f);
 }
 
 void Distortion_StudyAudioProcessor::releaseResources()
@@ -154,27 +180,59 @@ bool Distortion_StudyAudioProcessor::isBusesLayoutSupported (const BusesLayout&
 #endif
 
 void Distortion_StudyAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void Distortion_StudyAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool Distortion_StudyAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void Distortion_StudyAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     
-    juce::dsp::AudioBlock<float> audioBlock (buffer);
+    juce::dsp::AudioBlock<SampleType> audioBlock (buffer);
+    auto& chain = getDistortionProcessor<SampleType>();
     
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
     
     auto* rawInputGain = treeState.getRawParameterValue(inputGainSliderId);
-    distortionProcessor.get<0>().setGainDecibels(*rawInputGain);
+    chain.template get<0>().setGainDecibels(*rawInputGain);
     
     auto* rawBiasVoltage = treeState.getRawParameterValue(biasSliderId);
-    distortionProcessor.get<1>().setBias(*rawBiasVoltage);
+    chain.template get<1>().setBias(*rawBiasVoltage);
+    
+    if (rawBiasVoltage->load() != lastBias) {
+        lastBias = rawBiasVoltage->load();
+        silenceDetector.settingsChanged();
+    }
         
     auto* rawOutputGain = treeState.getRawParameterValue(outputGainSliderId);
-    distortionProcessor.get<3>().setGainDecibels(*rawOutputGain);
+    chain.template get<3>().setGainDecibels(*rawOutputGain);
+    
+    //Silent in, and silent out last time. The gains and bias jump to their targets
+    //instead of ramping, there's nothing to hear them move
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        chain.reset();
+        buffer.clear();
+        return;
+    }
     
-    distortionProcessor.process(juce::dsp::ProcessContextReplacing<float>(audioBlock));
+    chain.process(juce::dsp::ProcessContextReplacing<SampleType>(audioBlock));
     
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //==============================================================================
@@ -9,6 +9,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../../ViatorDSP/DistortionEngine.h"
+#include "../../ViatorDSP/SilenceDetector.h"
+#include "../../ViatorDSP/ProcessorMeter.h"
 
 #define inputGainSliderId "inputGain"
 #define inputGainSliderName "Input Gain"
@@ -38,6 +41,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -63,16 +68,43 @@ public:
     void setStateInformation (const void* data, int sizeInBytes) override;
 
     juce::AudioProcessorValueTreeState treeState;
-
     
+    //Block timing, read by the CSV log
+    ViatorDSP::ProcessorMeter meter;
+
 private:
     
-    using InputGainProcessor = juce::dsp::Gain<float>;
-    using BiasProcessor = juce::dsp::Bias<float>;
-    using WaveshapingProcessor = juce::dsp::WaveShaper<float>;
-    using OutputGainProcessor = juce::dsp::Gain<float>;
-
-    juce::dsp::ProcessorChain<InputGainProcessor, BiasProcessor, WaveshapingProcessor, OutputGainProcessor> distortionProcessor;
+    //Only when VIATOR_METER_LOG is set
+    std::unique_ptr<ViatorDSP::ProcessorMeterLogger> meterLogger;
+    
+    //Both processBlock overloads, the same code in float or double
+    template <typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer);
+    
+    template <typename SampleType> using InputGainProcessor = juce::dsp::Gain<SampleType>;
+    template <typename SampleType> using BiasProcessor = juce::dsp::Bias<SampleType>;
+    template <typename SampleType> using WaveshapingProcessor = ViatorDSP::DistortionEngine::Shaper<SampleType, ViatorDSP::DistortionEngine::Tanh>;
+    template <typename SampleType> using OutputGainProcessor = juce::dsp::Gain<SampleType>;
+
+    template <typename SampleType>
+    using DistortionChain = juce::dsp::ProcessorChain<InputGainProcessor<SampleType>, BiasProcessor<SampleType>,
+                                                      WaveshapingProcessor<SampleType>, OutputGainProcessor<SampleType>>;
+
+    //One chain per precision, the host only ever uses the one it asked for in prepareToPlay
+    DistortionChain<float> distortionProcessor;
+    DistortionChain<double> doubleDistortionProcessor;
+    
+    template <typename SampleType>
+    DistortionChain<SampleType>& getDistortionProcessor();
+    
+    template <typename SampleType>
+    void prepareDistortionProcessor(const juce::dsp::ProcessSpec& spec);
+    
+    //Skips the chain once the input, and what came out of it, has gone silent
+    ViatorDSP::SilenceDetector silenceDetector;
+    
+    //Any bias is an offset for silent input, so a new one has to be processed before skipping again
+    float lastBias = 0.0f;
     
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
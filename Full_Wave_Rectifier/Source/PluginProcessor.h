@@ -9,6 +9,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../../ViatorDSP/DistortionEngine.h"
+#include "../../ViatorDSP/SilenceDetector.h"
+#include "../../ViatorDSP/ProcessorMeter.h"
 
 #define inputSliderId "input"
 #define inputSliderName "Input"
@@ -34,6 +37,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -60,8 +65,24 @@ public:
     
     juce::AudioProcessorValueTreeState treeState;
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    
+    //Block timing, read by the CSV log
+    ViatorDSP::ProcessorMeter meter;
 
 private:
+    
+    //Only when VIATOR_METER_LOG is set
+    std::unique_ptr<ViatorDSP::ProcessorMeterLogger> meterLogger;
+    
+    //Both processBlock overloads, the same code in float or double
+    template <typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer);
+    
+    //Packs the channels into SIMD lanes when that's faster than running them one at a time
+    ViatorDSP::DistortionEngine::ChannelPacker channelPacker;
+    
+    //Skips the shaping once the input, and what came out of it, has gone silent
+    ViatorDSP::SilenceDetector silenceDetector;
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Full_Wave_RectifierAudioProcessor)
 };
@@ -23,6 +23,7 @@ Half_Wave_RectificationAudioProcessor::Half_Wave_RectificationAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 Half_Wave_RectificationAudioProcessor::~Half_Wave_RectificationAudioProcessor()
@@ -108,8 +109,10 @@ void Half_Wave_RectificationAudioProcessor::changeProgramName (int index, const
 //==============================================================================
 void Half_Wave_RectificationAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
+    meter.prepare(sampleRate);
+    
+    channelPacker.prepare(getTotalNumInputChannels(), samplesPerBlock);
+    silenceDetector.reset();
 }
 
 void Half_Wave_RectificationAudioProcessor::releaseResources()
@@ -145,33 +148,49 @@ bool Half_Wave_RectificationAudioProcessor::isBusesLayoutSupported (const BusesL
 #endif
 
 void Half_Wave_RectificationAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void Half_Wave_RectificationAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool Half_Wave_RectificationAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void Half_Wave_RectificationAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
-
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    {
-        auto* inputData = buffer.getReadPointer (channel);
-        auto* outputData = buffer.getWritePointer (channel);
-        
-        auto* rawInput = treeState.getRawParameterValue(inputSliderId);
-        auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
-
-        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-            
-            auto input = inputData[sample] * pow(10, *rawInput * 0.05);
-            
-            if (input >= 0){
-                outputData[sample] = input * pow(10, *rawTrim * 0.05);
-            } else {
-                outputData[sample] = 0;
-            }
-        }
+    
+    //Silent in, and silent out last time, so there's nothing to shape
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        buffer.clear();
+        return;
     }
+
+    auto* rawInput = treeState.getRawParameterValue(inputSliderId);
+    auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
+    
+    ViatorDSP::DistortionEngine::Coefficients coefficients;
+    coefficients.inputGain = pow(10, *rawInput * 0.05);
+    auto trimGain = static_cast<SampleType>(pow(10, *rawTrim * 0.05));
+    
+    juce::dsp::AudioBlock<SampleType> audioBlock (buffer);
+    auto inputChannels = audioBlock.getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+    channelPacker.process<ViatorDSP::DistortionEngine::HalfWaveRect>(inputChannels, coefficients, trimGain, static_cast<SampleType>(0));
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //==============================================================================
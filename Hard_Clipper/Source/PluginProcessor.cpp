@@ -23,6 +23,7 @@ Hard_ClipperAudioProcessor::Hard_ClipperAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 Hard_ClipperAudioProcessor::~Hard_ClipperAudioProcessor()
@@ -108,8 +109,10 @@ void Hard_ClipperAudioProcessor::changeProgramName (int index, const juce::Strin
 //==============================================================================
 void Hard_ClipperAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
+    meter.prepare(sampleRate);
+    
+    channelPacker.prepare(getTotalNumInputChannels(), samplesPerBlock);
+    silenceDetector.reset();
 }
 
 void Hard_ClipperAudioProcessor::releaseResources()
@@ -145,49 +148,58 @@ bool Hard_ClipperAudioProcessor::isBusesLayoutSupported (const BusesLayout& layo
 #endif
 
 void Hard_ClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void Hard_ClipperAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool Hard_ClipperAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void Hard_ClipperAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
-
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    {
-        auto* inputData = buffer.getReadPointer (channel);
-        auto* outputData = buffer.getWritePointer (channel);
-                
-        auto* rawThresh = treeState.getRawParameterValue(inputSliderId);
-        auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
-
-        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-                    
-            auto input = inputData[sample];
-            
-            //set thresh to be rounded to nearest 100th
-            float scale = 0.01;
-            
-            //make the range short in the first half and long at the end
-            auto threshScaled = floor(log10(*rawThresh + 1) / scale + 0.5f) * scale;
-            
-            //use scale function to reverse the direction of the dial
-            auto threshReversed = scaleRange(threshScaled, 0.0f, 1.4f, 1.0f, 0.02f);
-
-            //hard clipping
-            if (input >= threshReversed){
-                outputData[sample] = threshReversed * pow(10, *rawTrim * 0.05);
-            } else if (input <= (threshReversed * -1)) {
-                outputData[sample] = (threshReversed * -1) * pow(10, *rawTrim * 0.05);
-            } else {
-                outputData[sample] = input * pow(10, *rawTrim * 0.05);
-            }
-        }
+    
+    //Silent in, and silent out last time, so there's nothing to shape
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        buffer.clear();
+        return;
     }
-}
 
-float Hard_ClipperAudioProcessor::scaleRange(const float &input, const float &inputLow, const float &inputHigh, const float &outputLow, const float &outputHigh){
-    return ((input - inputLow) / (inputHigh - inputLow)) * (outputHigh - outputLow) + outputLow;
+    auto* rawThresh = treeState.getRawParameterValue(inputSliderId);
+    auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
+    
+    //set thresh to be rounded to nearest 100th
+    float scale = 0.01;
+    
+    //make the range short in the first half and long at the end
+    auto threshScaled = floor(log10(*rawThresh + 1) / scale + 0.5f) * scale;
+    
+    //use scale function to reverse the direction of the dial
+    ViatorDSP::DistortionEngine::Coefficients coefficients;
+    coefficients.threshold = ViatorDSP::scaleRange(threshScaled, 0.0f, 1.4f, 1.0f, 0.02f);
+    
+    auto trimGain = static_cast<SampleType>(pow(10, *rawTrim * 0.05));
+    
+    //hard clipping
+    juce::dsp::AudioBlock<SampleType> audioBlock (buffer);
+    auto inputChannels = audioBlock.getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+    channelPacker.process<ViatorDSP::DistortionEngine::HardClip>(inputChannels, coefficients, trimGain, static_cast<SampleType>(0));
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //==============================================================================
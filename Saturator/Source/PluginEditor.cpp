@@ -11,7 +11,7 @@
 
 //==============================================================================
 SaturatorAudioProcessorEditor::SaturatorAudioProcessorEditor (SaturatorAudioProcessor& p)
-    : AudioProcessorEditor (&p), audioProcessor (p)
+    : AudioProcessorEditor (&p), meterOverlay (p.meter), audioProcessor (p)
 {
     shadowProperties.radius = 24;
     shadowProperties.offset = juce::Point<int> (-1, 3);
@@ -30,6 +30,19 @@ SaturatorAudioProcessorEditor::SaturatorAudioProcessorEditor (SaturatorAudioProc
     driveSlider.setComponentEffect(&dialShadow);
     driveSliderAttach = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.treeState, driveSliderId, driveSlider);
     
+    //Side drive slider, how much less the side is driven in mid/side mode
+    addAndMakeVisible(sideDriveSlider);
+    sideDriveSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
+    sideDriveSlider.setTextBoxStyle(juce::Slider::TextBoxBelow, false, 64, 32);
+    sideDriveSlider.setRange(-24, 0, 0.5);
+    sideDriveSlider.setTextValueSuffix(" dB");
+    sideDriveSlider.setColour(0x1001400, juce::Colour::fromFloatRGBA(1, 1, 1, 0.5f));
+    sideDriveSlider.setColour(0x1001700, juce::Colour::fromFloatRGBA(1, 1, 1, 0.0f));
+    sideDriveSlider.setColour(0x1001500, juce::Colour::fromFloatRGBA(0, 0, 0, 0.25f));
+    sideDriveSlider.setLookAndFeel(&customDial);
+    sideDriveSlider.setComponentEffect(&dialShadow);
+    sideDriveSliderAttach = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.treeState, sideDriveId, sideDriveSlider);
+    
     //Trim slider
     addAndMakeVisible(trimSlider);
     trimSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
@@ -58,6 +71,42 @@ SaturatorAudioProcessorEditor::SaturatorAudioProcessorEditor (SaturatorAudioProc
     distortionType.addItem("Full-Wave Rect", 6);
     distortionTypeAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, modelId, distortionType);
     
+    //Oversampling menus, item ids are the choice index + 1
+    addAndMakeVisible(oversamplingMenu);
+    addAndMakeVisible(oversamplingFilterMenu);
+    addAndMakeVisible(antialiasingMenu);
+    addAndMakeVisible(processingModeMenu);
+    
+    for (auto* menu : {&oversamplingMenu, &oversamplingFilterMenu, &antialiasingMenu, &processingModeMenu}) {
+        menu->setColour(0x1000a00, juce::Colour::fromFloatRGBA(1, 1, 1, 0.5f));
+        menu->setColour(0x1000b00, juce::Colour::fromFloatRGBA(0, 0, 0, 0.25f));
+        menu->setColour(0x1000c00, juce::Colour::fromFloatRGBA(0, 0, 0, 0));
+        menu->setColour(0x1000e00, juce::Colour::fromFloatRGBA(0.392f, 0.584f, 0.929f, 0.25f));
+    }
+    
+    oversamplingMenu.addItemList({"1x", "2x", "4x", "8x", "16x"}, 1);
+    oversamplingMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, oversamplingId, oversamplingMenu);
+    
+    oversamplingFilterMenu.addItemList({"IIR", "FIR"}, 1);
+    oversamplingFilterMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, oversamplingFilterId, oversamplingFilterMenu);
+    
+    //ADAA only affects soft clip, hard clip and full-wave rect
+    antialiasingMenu.addItemList({"No ADAA", "ADAA 1st", "ADAA 2nd"}, 1);
+    antialiasingMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, antialiasingId, antialiasingMenu);
+    
+    //Linked shapes every channel by the loudest one, mid/side drives the side less, both without ADAA
+    processingModeMenu.addItemList({"Independent", "Linked", "Mid/Side"}, 1);
+    processingModeMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, processingModeId, processingModeMenu);
+    
+    //Economy only oversamples once the drive is past a few dB
+    addAndMakeVisible(economyButton);
+    economyButton.setColour(juce::ToggleButton::textColourId, juce::Colour::fromFloatRGBA(1, 1, 1, 0.5f));
+    economyButton.setColour(juce::ToggleButton::tickColourId, juce::Colour::fromFloatRGBA(0.392f, 0.584f, 0.929f, 0.5f));
+    economyButtonAttach = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(audioProcessor.treeState, economyId, economyButton);
+    
+    //Min/mean/p99/max block time and the share of the real time budget
+    addAndMakeVisible(meterOverlay);
+    
     //Making the window resizable by aspect ratio and setting size
     AudioProcessorEditor::setResizable(true, true);
     AudioProcessorEditor::setResizeLimits(300, 400, 450, 600);
@@ -83,6 +132,7 @@ void SaturatorAudioProcessorEditor::resized()
 {
     //Master bounds object
     juce::Rectangle<int> bounds = getLocalBounds();
+    meterOverlay.setBounds(bounds.removeFromBottom(16));
             
     //first column of gui
     juce::FlexBox flexboxColumnOne;
@@ -92,8 +142,35 @@ void SaturatorAudioProcessorEditor::resized()
             
     juce::Array<juce::FlexItem> itemArrayColumnOne;
     itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth() / 2, bounds.getHeight() / 10, distortionType).withMargin(juce::FlexItem::Margin(bounds.getWidth() * .05, 0, 0, 0)));
-    itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth() / 2.5, bounds.getHeight() / 2.5, driveSlider).withMargin(juce::FlexItem::Margin(0, 0, 0, 0)));
-    itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth() / 2.5, bounds.getHeight() / 2.5, trimSlider).withMargin(juce::FlexItem::Margin(0, 0, 0, 0)));
+    
+    //Oversampling row under the model menu
+    juce::FlexBox flexboxOversampling;
+    flexboxOversampling.flexDirection = juce::FlexBox::Direction::row;
+    flexboxOversampling.justifyContent = juce::FlexBox::JustifyContent::center;
+    flexboxOversampling.items.add(juce::FlexItem(bounds.getWidth() / 4.5, bounds.getHeight() / 14, oversamplingMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxOversampling.items.add(juce::FlexItem(bounds.getWidth() / 4.5, bounds.getHeight() / 14, oversamplingFilterMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxOversampling.items.add(juce::FlexItem(bounds.getWidth() / 5, bounds.getHeight() / 14, economyButton).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    
+    itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth(), bounds.getHeight() / 14, flexboxOversampling).withMargin(juce::FlexItem::Margin(bounds.getHeight() * .02, 0, 0, 0)));
+    
+    //ADAA and channel linking share the next row
+    juce::FlexBox flexboxModes;
+    flexboxModes.flexDirection = juce::FlexBox::Direction::row;
+    flexboxModes.justifyContent = juce::FlexBox::JustifyContent::center;
+    flexboxModes.items.add(juce::FlexItem(bounds.getWidth() / 3.2, bounds.getHeight() / 14, antialiasingMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxModes.items.add(juce::FlexItem(bounds.getWidth() / 3.2, bounds.getHeight() / 14, processingModeMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    
+    itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth(), bounds.getHeight() / 14, flexboxModes).withMargin(juce::FlexItem::Margin(bounds.getHeight() * .02, 0, 0, 0)));
+    
+    //Side drive sits next to drive, it only does anything in mid/side mode
+    juce::FlexBox flexboxDrive;
+    flexboxDrive.flexDirection = juce::FlexBox::Direction::row;
+    flexboxDrive.justifyContent = juce::FlexBox::JustifyContent::center;
+    flexboxDrive.items.add(juce::FlexItem(bounds.getWidth() / 2.5, bounds.getHeight() / 3.3, driveSlider).withMargin(juce::FlexItem::Margin(0, 0, 0, 0)));
+    flexboxDrive.items.add(juce::FlexItem(bounds.getWidth() / 3.5, bounds.getHeight() / 3.3, sideDriveSlider).withMargin(juce::FlexItem::Margin(0, 0, 0, 0)));
+    
+    itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth(), bounds.getHeight() / 3.3, flexboxDrive).withMargin(juce::FlexItem::Margin(0, 0, 0, 0)));
+    itemArrayColumnOne.add(juce::FlexItem(bounds.getWidth() / 2.5, bounds.getHeight() / 3.3, trimSlider).withMargin(juce::FlexItem::Margin(0, 0, 0, 0)));
 
     flexboxColumnOne.items = itemArrayColumnOne;
     flexboxColumnOne.performLayout(bounds.removeFromLeft(bounds.getWidth()));
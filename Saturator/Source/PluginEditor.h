@@ -41,6 +41,40 @@ public:
     }
 };
 
+//One line of the processor's block timing along the bottom of the editor
+class ProcessorMeterOverlay : public juce::Component, private juce::Timer{
+public:
+    explicit ProcessorMeterOverlay(const ViatorDSP::ProcessorMeter& meterToShow) : meter(meterToShow){
+        setInterceptsMouseClicks(false, false);
+        startTimerHz(4);
+    }
+    
+    void paint(juce::Graphics &g) override{
+        g.setColour(juce::Colour::fromFloatRGBA(1, 1, 1, 0.35f));
+        g.setFont(11.0f);
+        g.drawFittedText(text, getLocalBounds(), juce::Justification::centred, 1);
+    }
+    
+private:
+    void timerCallback() override{
+        auto statistics = meter.getStatistics();
+        
+        if (statistics.numBlocks == 0) {
+            return;
+        }
+        
+        text = "CPU " + juce::String(statistics.meanBudgetPercent, 1) + "% (p99 " + juce::String(statistics.p99BudgetPercent, 1) + "%)  "
+             + juce::String(statistics.minMicroseconds, 0) + "/" + juce::String(statistics.meanMicroseconds, 0) + "/"
+             + juce::String(statistics.p99Microseconds, 0) + "/" + juce::String(statistics.maxMicroseconds, 0) + " us  "
+             + "xrun risk " + juce::String(static_cast<juce::int64>(statistics.xrunRisks))
+             + "  denormal " + juce::String(static_cast<juce::int64>(statistics.denormalEvents));
+        repaint();
+    }
+    
+    const ViatorDSP::ProcessorMeter& meter;
+    juce::String text;
+};
+
 class SaturatorAudioProcessorEditor  : public juce::AudioProcessorEditor
 {
 public:
@@ -57,11 +91,14 @@ private:
     juce::DropShadow shadowProperties;
     juce::DropShadowEffect dialShadow;
     
-    juce::Slider driveSlider, trimSlider;
-    juce::ComboBox distortionType;
+    juce::Slider driveSlider, sideDriveSlider, trimSlider;
+    juce::ComboBox distortionType, oversamplingMenu, oversamplingFilterMenu, antialiasingMenu, processingModeMenu;
+    juce::ToggleButton economyButton {"Eco"};
+    ProcessorMeterOverlay meterOverlay;
     
-    std::unique_ptr <juce::AudioProcessorValueTreeState::SliderAttachment> driveSliderAttach, trimSliderAttach;
-    std::unique_ptr <juce::AudioProcessorValueTreeState::ComboBoxAttachment> distortionTypeAttach;
+    std::unique_ptr <juce::AudioProcessorValueTreeState::SliderAttachment> driveSliderAttach, sideDriveSliderAttach, trimSliderAttach;
+    std::unique_ptr <juce::AudioProcessorValueTreeState::ComboBoxAttachment> distortionTypeAttach, oversamplingMenuAttach, oversamplingFilterMenuAttach, antialiasingMenuAttach, processingModeMenuAttach;
+    std::unique_ptr <juce::AudioProcessorValueTreeState::ButtonAttachment> economyButtonAttach;
     
     SaturatorAudioProcessor& audioProcessor;
 
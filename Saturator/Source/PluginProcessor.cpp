@@ -23,24 +23,50 @@ SaturatorAudioProcessor::SaturatorAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    rawDrive = treeState.getRawParameterValue(driveSliderId);
+    rawTrim = treeState.getRawParameterValue(trimSliderId);
+    rawModel = treeState.getRawParameterValue(modelId);
+    rawOversampling = treeState.getRawParameterValue(oversamplingId);
+    rawOversamplingFilter = treeState.getRawParameterValue(oversamplingFilterId);
+    rawEconomy = treeState.getRawParameterValue(economyId);
+    rawAntialiasing = treeState.getRawParameterValue(antialiasingId);
+    rawProcessingMode = treeState.getRawParameterValue(processingModeId);
+    rawSideDrive = treeState.getRawParameterValue(sideDriveId);
+    
+    useVectorisedKernels = ViatorDSP::DistortionSIMD::isAvailable();
+    
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 SaturatorAudioProcessor::~SaturatorAudioProcessor()
 {
+    cancelPendingUpdate();
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout SaturatorAudioProcessor::createParameterLayout()
 {
     std::vector <std::unique_ptr<juce::RangedAudioParameter>> params;
-    params.reserve(3);
+    params.reserve(9);
     
     auto driveParam = std::make_unique<juce::AudioParameterFloat>(driveSliderId, driveSliderName, 0.0f, 24.0f, 0.0f);
     auto trimParam = std::make_unique<juce::AudioParameterFloat>(trimSliderId, trimSliderName, -36.0f, 36.0f, 0.0f);
     auto modelParam = std::make_unique<juce::AudioParameterInt>(modelId, modelName, 0, 6, 0);
+    auto oversamplingParam = std::make_unique<juce::AudioParameterChoice>(oversamplingId, oversamplingName, juce::StringArray {"1x", "2x", "4x", "8x", "16x"}, 0);
+    auto oversamplingFilterParam = std::make_unique<juce::AudioParameterChoice>(oversamplingFilterId, oversamplingFilterName, juce::StringArray {"IIR", "FIR"}, 0);
+    auto economyParam = std::make_unique<juce::AudioParameterBool>(economyId, economyName, false);
+    auto antialiasingParam = std::make_unique<juce::AudioParameterChoice>(antialiasingId, antialiasingName, juce::StringArray {"Off", "ADAA 1st Order", "ADAA 2nd Order"}, 0);
+    auto processingModeParam = std::make_unique<juce::AudioParameterChoice>(processingModeId, processingModeName, juce::StringArray {"Independent", "Linked", "Mid/Side"}, 0);
+    auto sideDriveParam = std::make_unique<juce::AudioParameterFloat>(sideDriveId, sideDriveName, -24.0f, 0.0f, 0.0f);
 
     params.push_back(std::move(driveParam));
     params.push_back(std::move(trimParam));
     params.push_back(std::move(modelParam));
+    params.push_back(std::move(oversamplingParam));
+    params.push_back(std::move(oversamplingFilterParam));
+    params.push_back(std::move(economyParam));
+    params.push_back(std::move(antialiasingParam));
+    params.push_back(std::move(processingModeParam));
+    params.push_back(std::move(sideDriveParam));
     
     return { params.begin(), params.end() };
 }
@@ -110,8 +136,138 @@ void SaturatorAudioProcessor::changeProgramName (int index, const juce::String&
 //==============================================================================
 void SaturatorAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
+    meter.prepare(sampleRate);
+    
+    driveSmoothed.reset(sampleRate, smoothingTimeSeconds);
+    driveSmoothed.setCurrentAndTargetValue(rawDrive->load());
+    
+    sideDriveSmoothed.reset(sampleRate, smoothingTimeSeconds);
+    sideDriveSmoothed.setCurrentAndTargetValue(rawSideDrive->load());
+    
+    trimSmoothed.reset(sampleRate, smoothingTimeSeconds);
+    trimSmoothed.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(rawTrim->load()));
+    
+    //Forces the output gain ramp to restart from the current settings
+    lastModel = -1;
+    
+    preparedBlockSize = samplesPerBlock;
+    auto numChannels = static_cast<size_t>(getTotalNumInputChannels());
+    
+    //The host picks the precision before preparing, so only that one needs anything allocated
+    if (isUsingDoublePrecision()) {
+        prepareBuffers<double>(sampleRate, samplesPerBlock);
+    } else {
+        prepareBuffers<float>(sampleRate, samplesPerBlock);
+    }
+    
+    oversampledMix.reset(sampleRate, economyFadeSeconds);
+    
+    //Built on first use, make sure that isn't the audio thread
+    ViatorDSP::DistortionEngine::Diode::getTable();
+    ViatorDSP::DistortionEngine::DCDistortion::getTable();
+    
+    hostRateStates.assign(numChannels, {});
+    oversampledStates.assign(numChannels, {});
+    
+    channelPacker.prepare(static_cast<int>(numChannels), samplesPerBlock << (numOversamplingChoices - 1));
+    silenceDetector.reset();
+    
+    updateOversampling(static_cast<int>(rawOversampling->load()), static_cast<int>(rawOversamplingFilter->load()));
+    
+    //Already on the message thread, nothing to post
+    cancelPendingUpdate();
+    latencyChanged.store(false);
+    setLatencySamples(oversamplerLatency.load());
+}
+
+template <typename SampleType>
+int SaturatorAudioProcessor::prepareBuffers(double sampleRate, int samplesPerBlock)
+{
+    auto& buffers = getBuffers<SampleType>();
+    auto numChannels = static_cast<size_t>(getTotalNumInputChannels());
+    int maxLatency = 0;
+    
+    for (int filter = 0; filter < numOversamplingFilters; ++filter) {
+        auto filterType = filter == 0 ? juce::dsp::Oversampling<SampleType>::filterHalfBandPolyphaseIIR
+                                      : juce::dsp::Oversampling<SampleType>::filterHalfBandFIREquiripple;
+        
+        for (int choice = 1; choice < numOversamplingChoices; ++choice) {
+            auto& oversampler = buffers.oversamplers[filter][choice];
+            oversampler = std::make_unique<juce::dsp::Oversampling<SampleType>>(numChannels, static_cast<size_t>(choice), filterType, true);
+            oversampler->initProcessing(static_cast<size_t>(samplesPerBlock));
+            maxLatency = juce::jmax(maxLatency, juce::roundToInt(oversampler->getLatencyInSamples()));
+        }
+    }
+    
+    buffers.hostRateDelay.prepare({sampleRate, static_cast<juce::uint32>(samplesPerBlock), static_cast<juce::uint32>(numChannels)});
+    buffers.hostRateDelay.setMaximumDelayInSamples(juce::jmax(1, maxLatency));
+    buffers.hostRateBuffer.setSize(static_cast<int>(numChannels), samplesPerBlock);
+    buffers.mixRamp.resize(static_cast<size_t>(samplesPerBlock));
+    buffers.linkBuffer.setSize(2, samplesPerBlock << (numOversamplingChoices - 1));
+    
+    //Whatever the other precision had from an earlier prepare
+    using OtherType = typename std::conditional<std::is_same<SampleType, float>::value, double, float>::type;
+    auto& otherBuffers = getBuffers<OtherType>();
+    
+    for (auto& filterOversamplers : otherBuffers.oversamplers) {
+        for (auto& oversampler : filterOversamplers) {
+            oversampler.reset();
+        }
+    }
+    
+    otherBuffers.activeOversampler = nullptr;
+    otherBuffers.hostRateBuffer.setSize(0, 0);
+    otherBuffers.mixRamp.clear();
+    otherBuffers.linkBuffer.setSize(0, 0);
+    
+    return maxLatency;
+}
+
+void SaturatorAudioProcessor::updateOversampling(int choice, int filter)
+{
+    activeOversamplingChoice = juce::jlimit(0, numOversamplingChoices - 1, choice);
+    activeOversamplingFilter = juce::jlimit(0, numOversamplingFilters - 1, filter);
+    floatBuffers.activeOversampler = floatBuffers.oversamplers[activeOversamplingFilter][activeOversamplingChoice].get();
+    doubleBuffers.activeOversampler = doubleBuffers.oversamplers[activeOversamplingFilter][activeOversamplingChoice].get();
+    
+    //Only one precision is prepared, the other's oversampler is null
+    int latency = 0;
+    bool hasOversampler = false;
+    
+    if (auto* oversampler = floatBuffers.activeOversampler) {
+        oversampler->reset();
+        latency = juce::roundToInt(oversampler->getLatencyInSamples());
+        hasOversampler = true;
+    }
+    
+    if (auto* oversampler = doubleBuffers.activeOversampler) {
+        oversampler->reset();
+        latency = juce::roundToInt(oversampler->getLatencyInSamples());
+        hasOversampler = true;
+    }
+    
+    floatBuffers.hostRateDelay.reset();
+    floatBuffers.hostRateDelay.setDelay(static_cast<float>(latency));
+    doubleBuffers.hostRateDelay.reset();
+    doubleBuffers.hostRateDelay.setDelay(static_cast<double>(latency));
+    
+    //Start on the oversampled path, economy mode moves off it on the next block if the drive is low
+    isOversampling = hasOversampler;
+    oversampledMix.setCurrentAndTargetValue(isOversampling ? 1.0f : 0.0f);
+    oversamplerWarmup = 0;
+    
+    //setLatencySamples makes the host restart playback, which isn't something to start from the audio thread
+    if (latency != oversamplerLatency.exchange(latency)) {
+        latencyChanged.store(true);
+        triggerAsyncUpdate();
+    }
+}
+
+void SaturatorAudioProcessor::handleAsyncUpdate()
+{
+    if (latencyChanged.exchange(false)) {
+        setLatencySamples(oversamplerLatency.load());
+    }
 }
 
 void SaturatorAudioProcessor::releaseResources()
@@ -127,12 +283,11 @@ bool SaturatorAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    //Channels are shaped alike whatever they carry, so mono and stereo through surround and
+    //immersive beds to ambisonics all work
+    auto channelSet = layouts.getMainOutputChannelSet();
+    
+    if (channelSet.isDisabled() || channelSet.size() > maxBusChannels)
         return false;
 
     // This checks if the input layout matches the output layout
@@ -147,120 +302,296 @@ bool SaturatorAudioProcessor::isBusesLayoutSupported (const BusesLayout& layouts
 #endif
 
 void SaturatorAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void SaturatorAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool SaturatorAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void SaturatorAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
+    auto numSamples = buffer.getNumSamples();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear (i, 0, buffer.getNumSamples());
-
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    {
-        auto* outputData = buffer.getWritePointer (channel);
-        auto* inputData = buffer.getReadPointer(channel);
-        auto* rawDrive = treeState.getRawParameterValue(driveSliderId);
-        auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
-        auto* rawModel = treeState.getRawParameterValue(modelId);
-        int model = *rawModel;
-
-        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
+        buffer.clear (i, 0, numSamples);
+    
+    //Parameter snapshot, read once per block
+    int model = static_cast<int>(rawModel->load());
+    int oversamplingChoice = static_cast<int>(rawOversampling->load());
+    int oversamplingFilter = static_cast<int>(rawOversamplingFilter->load());
+    int antialiasing = static_cast<int>(rawAntialiasing->load());
+    int mode = static_cast<int>(rawProcessingMode->load());
+    driveSmoothed.setTargetValue(rawDrive->load());
+    sideDriveSmoothed.setTargetValue(rawSideDrive->load());
+    trimSmoothed.setTargetValue(juce::Decibels::decibelsToGain(rawTrim->load()));
+    
+    if (oversamplingChoice != activeOversamplingChoice || oversamplingFilter != activeOversamplingFilter) {
+        updateOversampling(oversamplingChoice, oversamplingFilter);
+    }
+    
+    bool modelChanged = model != lastModel;
+    lastModel = model;
+    
+    //DC distortion puts out an offset for silence, so a new model has to be heard before anything is skipped
+    if (modelChanged) {
+        silenceDetector.settingsChanged();
+    }
+    
+    modelChanged = modelChanged || restartModel;
+    restartModel = false;
+    
+    //The ADAA history belongs to one curve, start it again when the curve or order changes,
+    //or when linked or mid/side (which don't keep it) hand back to independent
+    if (modelChanged || antialiasing != antialiasingMode || mode != processingMode) {
+        std::fill(hostRateStates.begin(), hostRateStates.end(), ViatorDSP::DistortionEngine::AntiderivativeState());
+        std::fill(oversampledStates.begin(), oversampledStates.end(), ViatorDSP::DistortionEngine::AntiderivativeState());
+        antialiasingMode = antialiasing;
+        processingMode = mode;
+    }
+    
+    //Silent in for longer than the oversampler and the delay hold, and silent out, so they have
+    //nothing left to play out. The filters' impulse responses run to about twice their latency,
+    //plus a sample for ADAA. The smoothers keep time, the first skipped block empties the filters,
+    //and the next block that isn't skipped restarts the output gain and ADAA history as a model
+    //change would
+    auto* activeOversampler = getBuffers<SampleType>().activeOversampler;
+    auto oversamplerLatency = activeOversampler != nullptr ? juce::roundToInt(activeOversampler->getLatencyInSamples()) : 0;
+    silenceDetector.setMinimumSilence(2 * oversamplerLatency + 1);
+    
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        if (silenceDetector.hasStartedSkipping()) {
+            auto& buffers = getBuffers<SampleType>();
             
-            switch (model) {
-                case 0:
-                    outputData[sample] = inputData[sample];
-                    break;
-                case 1:
-                    outputData[sample] = softClip(inputData[sample], *rawDrive) * pow(10, *rawTrim * 0.05f);
-                    break;
-                case 2:
-                    outputData[sample] = hardClip(inputData[sample], *rawDrive) * pow(10, *rawTrim * 0.05f);
-                    break;
-                case 4:
-                    outputData[sample] = dcDistortion(inputData[sample], *rawDrive) * pow(10, *rawTrim * 0.05f);
-                    break;
-                case 5:
-                    outputData[sample] = diode(inputData[sample], *rawDrive) * pow(10, *rawTrim * 0.05f);
-                    break;
-                case 6:
-                    outputData[sample] = fullWaveRect(inputData[sample], *rawDrive) * pow(10, *rawTrim * 0.05f);
-                    break;
-                    
-                default:
-                    outputData[sample] = inputData[sample];
-                    break;
+            if (buffers.activeOversampler != nullptr) {
+                buffers.activeOversampler->reset();
             }
+            
+            buffers.hostRateDelay.reset();
         }
+        
+        driveSmoothed.skip(numSamples);
+        sideDriveSmoothed.skip(numSamples);
+        trimSmoothed.skip(numSamples);
+        oversampledMix.setCurrentAndTargetValue(oversampledMix.getTargetValue());
+        oversamplerWarmup = 0;
+        restartModel = true;
+        
+        buffer.clear();
+        return;
     }
-}
-
-float SaturatorAudioProcessor::scaleRange(const float &input, const float &inputLow, const float &inputHigh, const float &outputLow, const float &outputHigh){
-    return ((input - inputLow) / (inputHigh - inputLow)) * (outputHigh - outputLow) + outputLow;
-}
-
-float SaturatorAudioProcessor::softClip(const float &input, const float &drive){
     
-    //1.5f to account for drop in gain from the saturation initial state
-    //pow(10, (-1 * drive) * 0.04f) to account for the increase in gain when the drive goes up
+    //The oversamplers are sized for the prepared block size, bigger host blocks are split
+    jassert(preparedBlockSize > 0);
+    auto block = juce::dsp::AudioBlock<SampleType>(buffer).getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
     
-    return piDivisor * atan(pow(10, (drive * 4) * 0.05f) * input) * 1.5f * pow(10, (-1 * drive) * 0.04f);
+    for (int startSample = 0; startSample < numSamples; startSample += preparedBlockSize) {
+        auto subBlockSize = juce::jmin(preparedBlockSize, numSamples - startSample);
+        processSubBlock(block.getSubBlock(static_cast<size_t>(startSample), static_cast<size_t>(subBlockSize)), model, modelChanged);
+        modelChanged = false;
+    }
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
-float SaturatorAudioProcessor::hardClip(const float &input, const float &drive){
-    
-    float driveScaled = scaleRange(drive, 0.0f, 24.0f, 1.0f, 0.0001f);
-    float output;
+template <typename SampleType>
+void SaturatorAudioProcessor::processSubBlock(juce::dsp::AudioBlock<SampleType> block, int model, bool modelChanged)
+{
+    auto& buffers = getBuffers<SampleType>();
+    auto* activeOversampler = buffers.activeOversampler;
     
-    if (input >= driveScaled){
-        output = driveScaled;
-    } else if (input <= (driveScaled * -1)){
-        output = driveScaled * -1;
-    } else {
-        output = input;
+    if (activeOversampler == nullptr) {
+        processAtRate(block, model, 1, modelChanged);
+        return;
     }
     
-    return output * 1.5f * pow(10, drive * 0.04);
-}
-
-float SaturatorAudioProcessor::dcDistortion(const float &input, const float &drive){
+    auto numSamples = block.getNumSamples();
+    auto hostBlock = juce::dsp::AudioBlock<SampleType>(buffers.hostRateBuffer).getSubsetChannelBlock(0, block.getNumChannels()).getSubBlock(0, numSamples);
+    auto& mixRamp = buffers.mixRamp;
+    
+    //Always fed, so the host rate path is ready the moment economy mode switches to it
+    buffers.hostRateDelay.process(juce::dsp::ProcessContextNonReplacing<SampleType>(block, hostBlock));
     
-    float dc = scaleRange(drive, 0.0f, 24.0, 0.75f, 1.0f);
-    float x = (input * pow(10, drive * 0.05f)) + dc;
-    float y;
-    float output;
+    //Bypass only needs the delay, economy mode oversamples above the drive threshold
+    bool wantsOversampling = model != bypassModel;
     
-    if (abs(x) > 1) {
-        x = sin(x);
+    if (wantsOversampling && rawEconomy->load() > 0.5f) {
+        auto threshold = isOversampling ? economyDriveThreshold - economyHysteresis : economyDriveThreshold;
+        wantsOversampling = driveSmoothed.getTargetValue() > threshold;
     }
     
-    y = x - 0.2f * pow(x, 5);
+    if (wantsOversampling != isOversampling) {
+        isOversampling = wantsOversampling;
+        
+        //The filters restart from silence, so hold the fade in until they've settled
+        if (isOversampling) {
+            activeOversampler->reset();
+        }
+        
+        oversamplerWarmup = isOversampling ? oversamplerLatency.load() : 0;
+        oversampledMix.setTargetValue(isOversampling ? 1.0f : 0.0f);
+    }
     
-    output = (y - dc);
+    bool isFading = oversampledMix.isSmoothing();
     
-    return output;
-}
-
-float SaturatorAudioProcessor::diode(const float &input, const float &drive){
+    if (! isOversampling && ! isFading) {
+        processAtRate(hostBlock, model, 1, modelChanged);
+        block.copyFrom(hostBlock);
+        return;
+    }
     
-    float diodeClipper;
+    //While fading both paths see the same input, so the smoothers are rewound before the second one
+    if (isFading) {
+        auto driveState = driveSmoothed;
+        auto sideDriveState = sideDriveSmoothed;
+        auto trimState = trimSmoothed;
+        auto gainState = lastOutputGain;
+        
+        processAtRate(hostBlock, model, 1, modelChanged);
+        
+        driveSmoothed = driveState;
+        sideDriveSmoothed = sideDriveState;
+        trimSmoothed = trimState;
+        lastOutputGain = gainState;
+    }
     
-    diodeClipper = 0.105 * (exp(0.1 * input / (1.68 * 0.0253)) - 1);
+    auto oversampledBlock = activeOversampler->processSamplesUp(block);
+    processAtRate(oversampledBlock, model, static_cast<int>(activeOversampler->getOversamplingFactor()), modelChanged);
+    activeOversampler->processSamplesDown(block);
     
-    return diodeClipper;
+    if (isFading) {
+        for (size_t sample = 0; sample < numSamples; ++sample) {
+            if (oversamplerWarmup > 0) {
+                --oversamplerWarmup;
+                mixRamp[sample] = oversampledMix.getCurrentValue();
+            } else {
+                mixRamp[sample] = oversampledMix.getNextValue();
+            }
+        }
+        
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel) {
+            auto* output = block.getChannelPointer(channel);
+            auto* hostRate = hostBlock.getChannelPointer(channel);
+            
+            for (size_t sample = 0; sample < numSamples; ++sample)
+                output[sample] = hostRate[sample] + (output[sample] - hostRate[sample]) * mixRamp[sample];
+        }
+    }
 }
 
-float SaturatorAudioProcessor::fullWaveRect(const float &input, const float &drive){
-    
-    float inputScaled = input;
-    float output;
+template <typename SampleType>
+void SaturatorAudioProcessor::processAtRate(juce::dsp::AudioBlock<SampleType> block, int model, int factor, bool modelChanged)
+{
+    //The model is dispatched once per block, each case runs a loop specialised for that curve
+    switch (model) {
+        case softClipModel:
+            processModel<ViatorDSP::DistortionEngine::SoftClip, SampleType>(block, factor, modelChanged);
+            break;
+        case hardClipModel:
+            processModel<ViatorDSP::DistortionEngine::HardClip, SampleType>(block, factor, modelChanged);
+            break;
+        case dcModel:
+            processModel<ViatorDSP::DistortionEngine::DCDistortion, SampleType>(block, factor, modelChanged);
+            break;
+        case diodeModel:
+            processModel<ViatorDSP::DistortionEngine::Diode, SampleType>(block, factor, modelChanged);
+            break;
+        case fullWaveRectModel:
+            processModel<ViatorDSP::DistortionEngine::FullWaveRect, SampleType>(block, factor, modelChanged);
+            break;
+            
+        default:
+            //Bypass leaves the buffer alone but keeps the smoothers in step
+            driveSmoothed.skip(static_cast<int>(block.getNumSamples()) / factor);
+            sideDriveSmoothed.skip(static_cast<int>(block.getNumSamples()) / factor);
+            trimSmoothed.skip(static_cast<int>(block.getNumSamples()) / factor);
+            break;
+    }
+}
+
+//The smoothers run at the host rate, so a segment of stepSize host samples covers stepSize * factor samples of the block
+template <typename Model, typename SampleType>
+void SaturatorAudioProcessor::processModel(juce::dsp::AudioBlock<SampleType> block, int factor, bool modelChanged)
+{
+    auto numSamples = static_cast<int>(block.getNumSamples()) / factor;
     
-    if (inputScaled >= 0.0f){
-        output = input;
-    } else {
-        output = input * -1;
+    //A new model has a different makeup gain, so jump to it instead of ramping
+    if (modelChanged) {
+        lastOutputGain = Model::makeCoefficients(driveSmoothed.getCurrentValue()).outputGain * trimSmoothed.getCurrentValue();
     }
     
-    return output;
+    int startSample = 0;
+    
+    while (startSample < numSamples) {
+        
+        //Coefficients are updated every few samples while a knob is moving,
+        //otherwise the whole block shares one set
+        bool isSmoothing = driveSmoothed.isSmoothing() || sideDriveSmoothed.isSmoothing() || trimSmoothed.isSmoothing();
+        int stepSize = isSmoothing ? juce::jmin(smoothingStepSize, numSamples - startSample) : numSamples - startSample;
+        
+        auto drive = driveSmoothed.skip(stepSize);
+        auto sideDrive = sideDriveSmoothed.skip(stepSize);
+        auto coefficients = Model::makeCoefficients(drive);
+        float targetGain = coefficients.outputGain * trimSmoothed.skip(stepSize);
+        auto gainStart = static_cast<SampleType>(lastOutputGain);
+        auto gainIncrement = (static_cast<SampleType>(targetGain) - gainStart) / static_cast<SampleType>(stepSize * factor);
+        
+        bool isLinked = processingMode == linkedMode && block.getNumChannels() > 1;
+        bool isMidSide = processingMode == midSideMode && block.getNumChannels() > 1;
+        bool usesAntiderivatives = false;
+        
+        if constexpr (Model::hasAntiderivatives) {
+            usesAntiderivatives = antialiasingMode != ViatorDSP::DistortionEngine::noAntialiasing && ! isLinked && ! isMidSide;
+            
+            //ADAA carries history per channel, so it always runs them one at a time
+            if (usesAntiderivatives) {
+                for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+                {
+                    auto* data = block.getChannelPointer(channel) + startSample * factor;
+                    auto& state = factor > 1 ? oversampledStates[channel] : hostRateStates[channel];
+                    ViatorDSP::DistortionEngine::processChannelAntiderivative<Model>(data, stepSize * factor, coefficients, gainStart, gainIncrement, antialiasingMode, state);
+                }
+            }
+        }
+        
+        auto segment = block.getSubBlock(static_cast<size_t>(startSample * factor), static_cast<size_t>(stepSize * factor));
+        
+        if (isLinked) {
+            auto& linkBuffer = getBuffers<SampleType>().linkBuffer;
+            ViatorDSP::DistortionEngine::processBlockLinked<Model>(segment, linkBuffer.getWritePointer(0), linkBuffer.getWritePointer(1),
+                                                                   coefficients, gainStart, gainIncrement, useVectorisedKernels);
+        } else if (isMidSide) {
+            //The side gets its own curve, driven less, and its own makeup relative to the mid's so
+            //the shared gain ramp still lands on the mid's output gain
+            auto sideCoefficients = Model::makeCoefficients(juce::jmax(0.0f, drive + sideDrive));
+            auto sideGain = static_cast<SampleType>(sideCoefficients.outputGain / coefficients.outputGain);
+            
+            ViatorDSP::DistortionEngine::processChannelsMidSide<Model>(segment.getChannelPointer(0), segment.getChannelPointer(1), stepSize * factor,
+                                                                       coefficients, sideCoefficients, sideGain, gainStart, gainIncrement, useVectorisedKernels);
+            
+            //Any channels past the first pair (the rest of a surround bed) are shaped as they are
+            if (segment.getNumChannels() > 2) {
+                channelPacker.process<Model>(segment.getSubsetChannelBlock(2, segment.getNumChannels() - 2), coefficients, gainStart, gainIncrement, useVectorisedKernels);
+            }
+        } else if (! usesAntiderivatives) {
+            channelPacker.process<Model>(segment, coefficients, gainStart, gainIncrement, useVectorisedKernels);
+        }
+        
+        lastOutputGain = targetGain;
+        startSample += stepSize;
+    }
 }
 
 //==============================================================================
@@ -9,6 +9,9 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "../../ViatorDSP/DistortionEngine.h"
+#include "../../ViatorDSP/ProcessorMeter.h"
+#include "../../ViatorDSP/SilenceDetector.h"
 
 #define driveSliderId "drive"
 #define driveSliderName "Drive"
@@ -16,11 +19,23 @@
 #define trimSliderName "Trim"
 #define modelId "model"
 #define modelName "Model"
+#define oversamplingId "oversampling"
+#define oversamplingName "Oversampling"
+#define oversamplingFilterId "oversamplingFilter"
+#define oversamplingFilterName "Oversampling Filter"
+#define economyId "economy"
+#define economyName "Economy"
+#define antialiasingId "antialiasing"
+#define antialiasingName "Anti-aliasing"
+#define processingModeId "processingMode"
+#define processingModeName "Processing"
+#define sideDriveId "sideDrive"
+#define sideDriveName "Side Drive"
 
 //==============================================================================
 /**
 */
-class SaturatorAudioProcessor  : public juce::AudioProcessor
+class SaturatorAudioProcessor  : public juce::AudioProcessor, private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -36,6 +51,8 @@ public:
    #endif
 
     void processBlock (juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
+    void processBlock (juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
+    bool supportsDoublePrecisionProcessing() const override;
 
     //==============================================================================
     juce::AudioProcessorEditor* createEditor() override;
@@ -60,20 +77,161 @@ public:
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
     
-    float scaleRange (const float &input, const float &inputLow, const float &inputHigh, const float &outputLow, const float &outputHigh);
+    //These match the values the model parameter takes when driven by the combo box
+    enum ModelId
+    {
+        bypassModel = 0,
+        softClipModel = 1,
+        hardClipModel = 2,
+        dcModel = 4,
+        diodeModel = 5,
+        fullWaveRectModel = 6
+    };
     
-    float softClip(const float &input, const float &drive);
-    float hardClip(const float &input, const float &drive);
-    float dcDistortion(const float &input, const float &drive);
-    float diode(const float &input, const float &drive);
-    float fullWaveRect(const float &input, const float &drive);
+    //Independent shapes every channel on its own, linked shapes them all by the loudest one,
+    //mid/side shapes the first pair as mid and side with the side driven by sideDrive on top
+    enum ProcessingMode
+    {
+        independentMode = 0,
+        linkedMode,
+        midSideMode
+    };
     
+    //Any layout up to this many channels, enough for 7.1.4 beds and 7th order ambisonics
+    static constexpr int maxBusChannels = 64;
+    
+
     juce::AudioProcessorValueTreeState treeState;
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
     
-    const float piDivisor = 2 / M_PI;
+    //Block timing for the editor's overlay and the CSV log
+    ViatorDSP::ProcessorMeter meter;
 
 private:
+    
+    //Only when VIATOR_METER_LOG is set
+    std::unique_ptr<ViatorDSP::ProcessorMeterLogger> meterLogger;
+    
+    std::atomic<float>* rawDrive = nullptr;
+    std::atomic<float>* rawTrim = nullptr;
+    std::atomic<float>* rawModel = nullptr;
+    std::atomic<float>* rawOversampling = nullptr;
+    std::atomic<float>* rawOversamplingFilter = nullptr;
+    std::atomic<float>* rawEconomy = nullptr;
+    std::atomic<float>* rawAntialiasing = nullptr;
+    std::atomic<float>* rawProcessingMode = nullptr;
+    std::atomic<float>* rawSideDrive = nullptr;
+    
+    //Drive and side drive are smoothed in dB, trim as a linear gain
+    juce::SmoothedValue<float> driveSmoothed;
+    juce::SmoothedValue<float> sideDriveSmoothed;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> trimSmoothed;
+    
+    //Output gain (model makeup * trim) reached at the end of the last block, the next block ramps from here
+    float lastOutputGain = 1.0f;
+    int lastModel = -1;
+    
+    //Set by skipped blocks, the next processed block restarts the output gain and ADAA as a model change would
+    bool restartModel = false;
+    
+    //Picked at startup, the scalar kernels are used on builds or CPUs without SIMD
+    bool useVectorisedKernels = false;
+    
+    //Lays the channels out across the SIMD lanes or one after another, whichever times faster.
+    //Sized for the highest oversampling factor since it runs at whatever rate the model does
+    ViatorDSP::DistortionEngine::ChannelPacker channelPacker;
+    
+    //Skips whole blocks once the input, and what the oversampler and delay made of it, has gone silent
+    ViatorDSP::SilenceDetector silenceDetector;
+    
+    static constexpr int smoothingStepSize = 32;
+    static constexpr double smoothingTimeSeconds = 0.05;
+    
+    //ADAA order for the models that support it, snapshot per block. The host rate and oversampled
+    //paths keep their own history since both run while economy mode crossfades
+    int antialiasingMode = ViatorDSP::DistortionEngine::noAntialiasing;
+    
+    //Snapshot per block. ADAA needs every channel's own history, so linked and mid/side run without it
+    int processingMode = independentMode;
+    std::vector<ViatorDSP::DistortionEngine::AntiderivativeState> hostRateStates, oversampledStates;
+    
+    //Oversampling choices are 1x, 2x, 4x, 8x, 16x, the filter is polyphase IIR (0) or FIR equiripple (1)
+    static constexpr int numOversamplingChoices = 5;
+    static constexpr int numOversamplingFilters = 2;
+    
+    //Economy mode drops to the host rate while drive is low. The host rate path is delayed by the
+    //oversampler latency so the reported latency never changes, and the two paths are crossfaded
+    static constexpr float economyDriveThreshold = 3.0f;
+    static constexpr float economyHysteresis = 1.0f;
+    static constexpr double economyFadeSeconds = 0.01;
+    
+    //Everything that holds samples, once for each precision. Only the one the host is
+    //using gets prepared, the other stays empty
+    template <typename SampleType>
+    struct SampleBuffers
+    {
+        //Every factor/filter pair is built in prepareToPlay so switching on the audio thread never allocates,
+        //index 0 (1x) stays empty
+        std::unique_ptr<juce::dsp::Oversampling<SampleType>> oversamplers[numOversamplingFilters][numOversamplingChoices];
+        juce::dsp::Oversampling<SampleType>* activeOversampler = nullptr;
+        
+        juce::dsp::DelayLine<SampleType, juce::dsp::DelayLineInterpolationTypes::None> hostRateDelay;
+        juce::AudioBuffer<SampleType> hostRateBuffer;
+        std::vector<SampleType> mixRamp;
+        
+        //Linked mode's key and shaped key, sized for the highest oversampling factor
+        juce::AudioBuffer<SampleType> linkBuffer;
+    };
+    
+    SampleBuffers<float> floatBuffers;
+    SampleBuffers<double> doubleBuffers;
+    
+    template <typename SampleType>
+    SampleBuffers<SampleType>& getBuffers() noexcept
+    {
+        if constexpr (std::is_same<SampleType, float>::value) {
+            return floatBuffers;
+        } else {
+            return doubleBuffers;
+        }
+    }
+    
+    //Builds the oversamplers and buffers for one precision and frees the other's, returns the largest latency
+    template <typename SampleType>
+    int prepareBuffers(double sampleRate, int samplesPerBlock);
+    
+    int activeOversamplingChoice = 0;
+    int activeOversamplingFilter = 0;
+    int preparedBlockSize = 0;
+    
+    juce::SmoothedValue<float> oversampledMix;
+    int oversamplerWarmup = 0;
+    bool isOversampling = false;
+    
+    //The active oversampler's latency. Set on the audio thread, reported to the host from the message thread
+    std::atomic<int> oversamplerLatency {0};
+    std::atomic<bool> latencyChanged {false};
+    
+    //Switches the active oversampler and posts its latency to the message thread
+    void updateOversampling(int choice, int filter);
+    void handleAsyncUpdate() override;
+    
+    //Both processBlock overloads, the same code in float or double
+    template <typename SampleType>
+    void process(juce::AudioBuffer<SampleType>& buffer);
+    
+    //Processes at most preparedBlockSize samples, oversampling the non-linearity when it's enabled
+    template <typename SampleType>
+    void processSubBlock(juce::dsp::AudioBlock<SampleType> block, int model, bool modelChanged);
+    
+    //Runs the model over a block at factor times the host rate
+    template <typename SampleType>
+    void processAtRate(juce::dsp::AudioBlock<SampleType> block, int model, int factor, bool modelChanged);
+    
+    //Runs the whole block through one model, the model is resolved at compile time
+    template <typename Model, typename SampleType>
+    void processModel(juce::dsp::AudioBlock<SampleType> block, int factor, bool modelChanged);
+    
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SaturatorAudioProcessor)
 };
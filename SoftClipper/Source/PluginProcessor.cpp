@@ -22,6 +22,7 @@ SoftClipperAudioProcessor::SoftClipperAudioProcessor()
                        )
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 SoftClipperAudioProcessor::~SoftClipperAudioProcessor()
@@ -93,8 +94,9 @@ void SoftClipperAudioProcessor::changeProgramName (int index, const juce::String
 //==============================================================================
 void SoftClipperAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
+    meter.prepare(sampleRate);
+    
+    silenceDetector.reset();
 }
 
 void SoftClipperAudioProcessor::releaseResources()
@@ -130,8 +132,25 @@ bool SoftClipperAudioProcessor::isBusesLayoutSupported (const BusesLayout& layou
 #endif
 
 void SoftClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void SoftClipperAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool SoftClipperAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void SoftClipperAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -143,6 +162,12 @@ void SoftClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
     // this code if your algorithm always overwrites all the output channels.
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
+    
+    //Silent in, and silent out last time, so there's nothing to pass on
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        buffer.clear();
+        return;
+    }
 
     // This is the place where you'd normally do the guts of your plugin's
     // audio processing...
@@ -155,7 +180,10 @@ void SoftClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer,
         auto* channelData = buffer.getWritePointer (channel);
 
         // ..do something to the data...
+        juce::ignoreUnused (channelData);
     }
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //==============================================================================
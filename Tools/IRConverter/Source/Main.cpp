@@ -0,0 +1,132 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Builds pre-partitioned .pir files from IR captures, one per input, for
+    the pedal to map instead of decoding. Directories are searched for .wav
+    files.
+
+    Usage:
+      IRConverter [--sample-rates=44100,48000,88200,96000]
+                  [--layouts=zero,low,balanced,throughput]
+                  [--output=directory] [--no-trim] [--no-normalise]
+                  files or directories...
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "PartitionedImpulseResponseFile.h"
+
+template <typename Type>
+static juce::Array<Type> parseList(const juce::String& text)
+{
+    juce::Array<Type> values;
+
+    for (auto& token : juce::StringArray::fromTokens(text, ",", ""))
+        if (token.trim().isNotEmpty())
+            values.add(static_cast<Type>(token.trim().getDoubleValue()));
+
+    return values;
+}
+
+//The convolution mode presets by the names used on the command line, empty if one isn't known
+static std::vector<PartitionedConvolver::Layout> parseLayouts(const juce::String& text)
+{
+    const juce::StringArray names { "zero", "low", "balanced", "throughput" };
+    std::vector<PartitionedConvolver::Layout> layouts;
+
+    for (auto& token : juce::StringArray::fromTokens(text, ",", "")) {
+        auto index = names.indexOf(token.trim(), true);
+
+        if (index < 0)
+            return {};
+
+        layouts.push_back(PartitionedConvolver::getPresetLayout(static_cast<PartitionedConvolver::Preset>(index)));
+    }
+
+    return layouts;
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h") || args.size() == 0) {
+        std::cout << "Usage: " << args.executableName.toStdString()
+                  << " [--sample-rates=44100,48000,88200,96000] [--layouts=zero,low,balanced,throughput]"
+                     " [--output=directory] [--no-trim] [--no-normalise] files or directories..." << std::endl;
+        return 0;
+    }
+
+    juce::Array<double> sampleRates { 44100.0, 48000.0, 88200.0, 96000.0 };
+    auto layouts = parseLayouts("zero,low,balanced,throughput");
+
+    if (args.containsOption("--sample-rates"))
+        sampleRates = parseList<double>(args.getValueForOption("--sample-rates"));
+
+    if (args.containsOption("--layouts"))
+        layouts = parseLayouts(args.getValueForOption("--layouts"));
+
+    if (sampleRates.isEmpty() || layouts.empty()) {
+        std::cerr << "Nothing to build, check --sample-rates and --layouts" << std::endl;
+        return 1;
+    }
+
+    auto trim = ! args.containsOption("--no-trim");
+    auto normalise = ! args.containsOption("--no-normalise");
+
+    juce::Array<juce::File> inputs;
+
+    for (auto& argument : args.arguments) {
+        if (argument.isOption())
+            continue;
+
+        auto file = argument.resolveAsFile();
+
+        if (file.isDirectory())
+            inputs.addArray(file.findChildFiles(juce::File::findFiles, false, "*.wav"));
+        else
+            inputs.add(file);
+    }
+
+    auto outputDirectory = args.containsOption("--output") ? args.getFileForOption("--output") : juce::File();
+
+    if (outputDirectory != juce::File() && ! outputDirectory.createDirectory()) {
+        std::cerr << "Couldn't create " << outputDirectory.getFullPathName().toStdString() << std::endl;
+        return 1;
+    }
+
+    int failures = 0;
+
+    for (auto& input : inputs) {
+        juce::MemoryBlock fileData;
+        double fileSampleRate = 0.0;
+
+        auto impulseResponse = input.loadFileAsData(fileData)
+                                 ? PartitionedConvolver::readImpulseResponse(fileData.getData(), fileData.getSize(), fileSampleRate)
+                                 : juce::AudioBuffer<float>();
+
+        if (impulseResponse.getNumSamples() == 0) {
+            std::cerr << "Couldn't read " << input.getFullPathName().toStdString() << std::endl;
+            ++failures;
+            continue;
+        }
+
+        auto output = (outputDirectory != juce::File() ? outputDirectory.getChildFile(input.getFileName()) : input)
+                          .withFileExtension(PartitionedImpulseResponseFile::fileExtension);
+
+        if (! PartitionedImpulseResponseFile::write(output, impulseResponse, fileSampleRate, sampleRates, layouts, trim, normalise)) {
+            std::cerr << "Couldn't write " << output.getFullPathName().toStdString() << std::endl;
+            ++failures;
+            continue;
+        }
+
+        std::cerr << input.getFileName().toStdString() << " -> " << output.getFullPathName().toStdString() << " ("
+                  << output.getSize() / 1024 << " KB, " << sampleRates.size() * static_cast<int>(layouts.size()) << " filters)" << std::endl;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
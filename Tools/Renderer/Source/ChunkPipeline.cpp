@@ -0,0 +1,169 @@
+/*
+  ==============================================================================
+
+    ChunkPipeline.cpp
+
+  ==============================================================================
+*/
+
+#include "ChunkPipeline.h"
+
+ChunkPipeline::ChunkPipeline(juce::AudioFormatReader& readerToUse, juce::AudioFormatWriter& writerToUse,
+                             int chunkSize, int latencySamples, juce::int64 tailSamples, int numChunks)
+: juce::Thread("Render I/O"), reader(readerToUse), writer(writerToUse),
+  inputLength(readerToUse.lengthInSamples), latencyLength(juce::jmax(0, latencySamples)),
+  tailLength(juce::jmax<juce::int64>(0, tailSamples)), totalLength(inputLength + latencyLength + tailLength)
+{
+    //Fewer than three and reading, processing and writing can't all happen at once
+    chunks.resize(static_cast<size_t>(juce::jmax(3, numChunks)));
+
+    for (auto& chunk : chunks)
+        chunk.buffer.setSize(static_cast<int>(reader.numChannels), juce::jmax(1, chunkSize));
+
+    startThread();
+}
+
+ChunkPipeline::~ChunkPipeline()
+{
+    stopThread(4000);
+}
+
+ChunkPipeline::Chunk* ChunkPipeline::getNextInput()
+{
+    for (;;) {
+        {
+            const juce::ScopedLock scopedLock(lock);
+
+            if (errorMessage.isNotEmpty())
+                return nullptr;
+
+            if (numTaken < numRead)
+                return &chunks[static_cast<size_t>(numTaken++ % static_cast<juce::int64>(chunks.size()))];
+
+            if (readPosition >= totalLength)
+                return nullptr;
+        }
+
+        chunkRead.wait();
+    }
+}
+
+void ChunkPipeline::submitOutput(Chunk* chunk)
+{
+    {
+        const juce::ScopedLock scopedLock(lock);
+
+        //Back in the order they were handed out
+        jassert(chunk == &chunks[static_cast<size_t>(numSubmitted % static_cast<juce::int64>(chunks.size()))]);
+        juce::ignoreUnused(chunk);
+
+        ++numSubmitted;
+    }
+
+    notify();
+}
+
+juce::Result ChunkPipeline::finish()
+{
+    for (;;) {
+        {
+            const juce::ScopedLock scopedLock(lock);
+
+            if (errorMessage.isNotEmpty())
+                return juce::Result::fail(errorMessage);
+
+            if (numWritten == numSubmitted)
+                return juce::Result::ok();
+        }
+
+        chunkWritten.wait();
+    }
+}
+
+void ChunkPipeline::run()
+{
+    const auto numChunks = static_cast<juce::int64>(chunks.size());
+
+    while (! threadShouldExit()) {
+        Chunk* chunkToWrite = nullptr;
+        Chunk* chunkToRead = nullptr;
+
+        {
+            const juce::ScopedLock scopedLock(lock);
+
+            if (errorMessage.isNotEmpty())
+                return;
+
+            //Writing first, it's what frees a chunk for the next read
+            if (numWritten < numSubmitted)
+                chunkToWrite = &chunks[static_cast<size_t>(numWritten % numChunks)];
+            else if (numRead - numWritten < numChunks && readPosition < totalLength)
+                chunkToRead = &chunks[static_cast<size_t>(numRead % numChunks)];
+        }
+
+        if (chunkToWrite != nullptr) {
+            if (! writeChunk(*chunkToWrite))
+                return fail("Couldn't write the output");
+
+            {
+                const juce::ScopedLock scopedLock(lock);
+                ++numWritten;
+            }
+
+            chunkWritten.signal();
+            continue;
+        }
+
+        if (chunkToRead != nullptr) {
+            //Only this thread moves readPosition, the caller just compares against it
+            chunkToRead->position = readPosition;
+            chunkToRead->numSamples = static_cast<int>(juce::jmin<juce::int64>(chunkToRead->buffer.getNumSamples(), totalLength - readPosition));
+
+            if (! readChunk(*chunkToRead))
+                return fail("Couldn't read the input");
+
+            {
+                const juce::ScopedLock scopedLock(lock);
+                ++numRead;
+                readPosition += chunkToRead->numSamples;
+            }
+
+            chunkRead.signal();
+            continue;
+        }
+
+        //Nothing to write and every chunk is full, until the caller submits one
+        wait(-1);
+    }
+}
+
+bool ChunkPipeline::readChunk(Chunk& chunk)
+{
+    auto numFromInput = static_cast<int>(juce::jlimit<juce::int64>(0, chunk.numSamples, inputLength - chunk.position));
+
+    if (numFromInput < chunk.numSamples)
+        chunk.buffer.clear(numFromInput, chunk.numSamples - numFromInput);
+
+    return numFromInput == 0 || reader.read(&chunk.buffer, 0, numFromInput, chunk.position, true, true);
+}
+
+bool ChunkPipeline::writeChunk(const Chunk& chunk)
+{
+    //Output sample n is processed sample n + latencyLength
+    auto start = juce::jlimit<juce::int64>(0, chunk.numSamples, latencyLength - chunk.position);
+    auto end = juce::jlimit<juce::int64>(0, chunk.numSamples, totalLength - chunk.position);
+
+    return end <= start || writer.writeFromAudioSampleBuffer(chunk.buffer, static_cast<int>(start), static_cast<int>(end - start));
+}
+
+void ChunkPipeline::fail(const juce::String& message)
+{
+    {
+        const juce::ScopedLock scopedLock(lock);
+        errorMessage = message;
+    }
+
+    //Both so whichever the caller is waiting on wakes up
+    chunkRead.signal();
+    chunkWritten.signal();
+}
@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+
+    ChunkPipeline.h
+
+    Streams one file through a small fixed set of chunk buffers so disk I/O
+    overlaps the DSP. A background thread reads ahead into free chunks and
+    writes processed ones back out, while the caller only ever processes:
+
+      read chunk n + 1  |  process chunk n  |  write chunk n - 1
+
+    Peak memory is numChunks buffers of chunkSize samples per channel,
+    whatever the file length.
+
+    Past the end of the input the chunks carry on as silence for
+    latencySamples plus tailSamples more. The first latencySamples of output
+    are dropped, which compensates a processor's latency so the output lines
+    up with the input, and the output runs tailSamples past the input's end
+    so whatever the processor rings on for is kept.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class ChunkPipeline : private juce::Thread
+{
+public:
+    struct Chunk
+    {
+        juce::AudioBuffer<float> buffer;
+
+        //Position of the first sample in the input, padding included
+        juce::int64 position = 0;
+        int numSamples = 0;
+    };
+
+    //Starts reading straight away. Both reader and writer must outlive the pipeline
+    ChunkPipeline(juce::AudioFormatReader& reader, juce::AudioFormatWriter& writer,
+                  int chunkSize, int latencySamples, juce::int64 tailSamples, int numChunks = 3);
+    ~ChunkPipeline() override;
+
+    //The next chunk in order, waiting for it to be read if need be. Null once the input
+    //and its tail have all been handed out, or reading or writing failed
+    Chunk* getNextInput();
+
+    //Hands the chunk from the last getNextInput back once processed, to be written
+    void submitOutput(Chunk* chunk);
+
+    //Waits for everything submitted to be written
+    juce::Result finish();
+
+private:
+
+    void run() override;
+
+    bool readChunk(Chunk& chunk);
+    bool writeChunk(const Chunk& chunk);
+    void fail(const juce::String& message);
+
+    juce::AudioFormatReader& reader;
+    juce::AudioFormatWriter& writer;
+
+    const juce::int64 inputLength;
+    const juce::int64 latencyLength;
+    const juce::int64 tailLength;
+    const juce::int64 totalLength;
+
+    std::vector<Chunk> chunks;
+
+    //Running totals, chunk n lives in chunks[n % chunks.size()]. Guarded by lock
+    juce::CriticalSection lock;
+    juce::int64 numRead = 0;
+    juce::int64 numTaken = 0;
+    juce::int64 numSubmitted = 0;
+    juce::int64 numWritten = 0;
+    juce::int64 readPosition = 0;
+    juce::String errorMessage;
+
+    //Caller waits on these, the background thread on its own notify
+    juce::WaitableEvent chunkRead;
+    juce::WaitableEvent chunkWritten;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChunkPipeline)
+};
@@ -0,0 +1,144 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Renders audio files through one processor offline, see OfflineRenderer.h.
+    Directories are searched for any file a basic format can read.
+
+    Usage:
+      <Processor>_Render [--set=id=value,...] [--preset=file]
+                         [--output=directory] [--suffix=_render]
+                         [--format=wav|aiff|flac] [--bit-depth=16|24|32]
+                         [--block-size=8192] [--chunk-kb=1024] [--threads=n] [--double]
+                         [--no-tail] [--list-parameters] files or directories...
+
+    Outputs run on for the processor's tail past the end of the input,
+    --no-tail cuts them at the input's length.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "OfflineRenderer.h"
+
+//Defined by the processor library this executable is linked against
+juce::AudioProcessor* JUCE_CALLTYPE createPluginFilter();
+
+//"drive=12,oversampling=4x" into id/value pairs
+static juce::StringPairArray parseParameters(const juce::String& text)
+{
+    juce::StringPairArray parameters;
+
+    for (auto& token : juce::StringArray::fromTokens(text, ",", "\""))
+        if (token.contains("="))
+            parameters.set(token.upToFirstOccurrenceOf("=", false, false).trim(),
+                           token.fromFirstOccurrenceOf("=", false, false).trim().unquoted());
+
+    return parameters;
+}
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args(argc, argv);
+
+    auto createProcessor = [] { return std::unique_ptr<juce::AudioProcessor>(createPluginFilter()); };
+
+    if (args.containsOption("--help|-h") || args.size() == 0) {
+        std::cout << "Usage: " << args.executableName.toStdString()
+                  << " [--set=id=value,...] [--preset=file] [--output=directory] [--suffix=_render]"
+                     " [--format=wav|aiff|flac] [--bit-depth=16|24|32] [--block-size=8192] [--chunk-kb=1024] [--threads=n]"
+                     " [--double] [--no-tail] [--list-parameters] files or directories..." << std::endl;
+        return 0;
+    }
+
+    if (args.containsOption("--list-parameters")) {
+        auto processor = createProcessor();
+
+        for (auto& line : OfflineRenderer::describeParameters(*processor))
+            std::cout << line.toStdString() << std::endl;
+
+        return 0;
+    }
+
+    RenderSettings settings;
+
+    if (args.containsOption("--set"))
+        settings.parameters = parseParameters(args.getValueForOption("--set"));
+
+    if (args.containsOption("--preset"))
+        settings.presetFile = args.getFileForOption("--preset");
+
+    if (args.containsOption("--output"))
+        settings.outputDirectory = args.getFileForOption("--output");
+
+    if (args.containsOption("--format"))
+        settings.outputFormat = args.getValueForOption("--format");
+
+    if (args.containsOption("--bit-depth"))
+        settings.bitDepth = args.getValueForOption("--bit-depth").getIntValue();
+
+    if (args.containsOption("--block-size"))
+        settings.blockSize = args.getValueForOption("--block-size").getIntValue();
+
+    if (args.containsOption("--chunk-kb"))
+        settings.chunkBytes = static_cast<size_t>(juce::jmax(1, args.getValueForOption("--chunk-kb").getIntValue())) * 1024;
+
+    if (args.containsOption("--threads"))
+        settings.numThreads = args.getValueForOption("--threads").getIntValue();
+
+    settings.useDoublePrecision = args.containsOption("--double");
+    settings.truncateTail = args.containsOption("--no-tail");
+
+    //Written next to the inputs unless told otherwise, so they need a different name
+    settings.outputSuffix = args.containsOption("--suffix") ? args.getValueForOption("--suffix")
+                          : (settings.outputDirectory == juce::File() ? "_render" : "");
+
+    if (settings.outputDirectory != juce::File() && ! settings.outputDirectory.createDirectory()) {
+        std::cerr << "Couldn't create " << settings.outputDirectory.getFullPathName().toStdString() << std::endl;
+        return 1;
+    }
+
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    juce::Array<juce::File> inputs;
+
+    for (auto& argument : args.arguments) {
+        if (argument.isOption())
+            continue;
+
+        auto file = argument.resolveAsFile();
+
+        if (file.isDirectory())
+            inputs.addArray(file.findChildFiles(juce::File::findFiles, false, formatManager.getWildcardForAllFormats()));
+        else
+            inputs.add(file);
+    }
+
+    //Every worker gets a processor, no point making more than there are files
+    settings.numThreads = juce::jlimit(1, juce::jmax(1, inputs.size()), settings.numThreads);
+
+    OfflineRenderer renderer(createProcessor, settings);
+    auto initialised = renderer.initialise();
+
+    if (initialised.failed()) {
+        std::cerr << initialised.getErrorMessage().toStdString() << std::endl;
+        return 1;
+    }
+
+    auto startTime = juce::Time::getMillisecondCounterHiRes();
+
+    auto failures = renderer.render(inputs, [] (const juce::File& input, const juce::File& output, const juce::Result& result) {
+        if (result.wasOk())
+            std::cerr << input.getFileName().toStdString() << " -> " << output.getFullPathName().toStdString() << std::endl;
+        else
+            std::cerr << input.getFileName().toStdString() << ": " << result.getErrorMessage().toStdString() << std::endl;
+    });
+
+    std::cerr << inputs.size() - failures << " of " << inputs.size() << " files rendered in "
+              << (juce::Time::getMillisecondCounterHiRes() - startTime) / 1000.0 << " s" << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,301 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.cpp
+
+  ==============================================================================
+*/
+
+#include "OfflineRenderer.h"
+#include "ChunkPipeline.h"
+
+//Shared by every job of one render call
+struct OfflineRenderer::Batch
+{
+    std::function<void(const juce::File&, const juce::File&, const juce::Result&)> onFinished;
+    juce::CriticalSection callbackLock;
+
+    std::atomic<int> remaining { 0 };
+    std::atomic<int> failures { 0 };
+    juce::WaitableEvent allDone;
+};
+
+class OfflineRenderer::RenderJob : public juce::ThreadPoolJob
+{
+public:
+    RenderJob(OfflineRenderer& ownerToUse, Batch& batchToUse, const juce::File& inputToUse)
+    : juce::ThreadPoolJob("Render " + inputToUse.getFileName()), owner(ownerToUse), batch(batchToUse), input(inputToUse)
+    {
+    }
+
+    JobStatus runJob() override
+    {
+        auto output = owner.getOutputFile(input);
+        auto* processor = owner.acquireProcessor();
+        auto result = owner.renderFile(*processor, input, output);
+        owner.releaseProcessor(processor);
+
+        if (result.failed())
+            ++batch.failures;
+
+        if (batch.onFinished != nullptr) {
+            const juce::ScopedLock lock(batch.callbackLock);
+            batch.onFinished(input, output, result);
+        }
+
+        if (--batch.remaining == 0)
+            batch.allDone.signal();
+
+        return jobHasFinished;
+    }
+
+private:
+    OfflineRenderer& owner;
+    Batch& batch;
+    juce::File input;
+};
+
+OfflineRenderer::OfflineRenderer(ProcessorFactory factoryToUse, RenderSettings settingsToUse)
+: factory(std::move(factoryToUse)), settings(std::move(settingsToUse))
+{
+    settings.numThreads = juce::jmax(1, settings.numThreads);
+    settings.blockSize = juce::jmax(1, settings.blockSize);
+
+    formatManager.registerBasicFormats();
+}
+
+OfflineRenderer::~OfflineRenderer()
+{
+    for (auto& processor : processors)
+        processor->releaseResources();
+}
+
+juce::Result OfflineRenderer::initialise()
+{
+    const juce::ScopedLock lock(processorLock);
+
+    processors.clear();
+    freeProcessors.clear();
+
+    for (int index = 0; index < settings.numThreads; ++index) {
+        auto processor = factory();
+
+        if (processor == nullptr)
+            return juce::Result::fail("Couldn't create the processor");
+
+        auto result = applySettings(*processor);
+
+        if (result.failed())
+            return result;
+
+        freeProcessors.add(processor.get());
+        processors.push_back(std::move(processor));
+    }
+
+    return juce::Result::ok();
+}
+
+int OfflineRenderer::render(const juce::Array<juce::File>& inputs,
+                            std::function<void(const juce::File&, const juce::File&, const juce::Result&)> onFinished)
+{
+    if (inputs.isEmpty())
+        return 0;
+
+    Batch batch;
+    batch.onFinished = std::move(onFinished);
+    batch.remaining = inputs.size();
+
+    //Never more workers than processors, so acquireProcessor always finds one free
+    juce::ThreadPool pool(static_cast<int>(processors.size()));
+
+    for (auto& input : inputs)
+        pool.addJob(new RenderJob(*this, batch, input), true);
+
+    batch.allDone.wait();
+    return batch.failures.load();
+}
+
+juce::File OfflineRenderer::getOutputFile(const juce::File& input) const
+{
+    auto directory = settings.outputDirectory != juce::File() ? settings.outputDirectory : input.getParentDirectory();
+    auto extension = settings.outputFormat.isEmpty() ? input.getFileExtension()
+                   : (settings.outputFormat.startsWithChar('.') ? settings.outputFormat : "." + settings.outputFormat);
+
+    return directory.getChildFile(input.getFileNameWithoutExtension() + settings.outputSuffix + extension);
+}
+
+juce::StringArray OfflineRenderer::describeParameters(juce::AudioProcessor& processor)
+{
+    juce::StringArray lines;
+
+    for (auto* parameter : processor.getParameters()) {
+        auto* parameterWithId = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter);
+        auto line = (parameterWithId != nullptr ? parameterWithId->paramID : juce::String(parameter->getParameterIndex()))
+                  + " (" + parameter->getName(64) + ") = " + parameter->getCurrentValueAsText();
+
+        if (parameter->isDiscrete() && parameter->getAllValueStrings().size() > 0)
+            line << " [" << parameter->getAllValueStrings().joinIntoString(", ") << "]";
+        else
+            line << " [" << parameter->getText(0.0f, 32) << " .. " << parameter->getText(1.0f, 32) << "]";
+
+        lines.add(line);
+    }
+
+    return lines;
+}
+
+juce::Result OfflineRenderer::applySettings(juce::AudioProcessor& processor) const
+{
+    if (settings.presetFile != juce::File()) {
+        juce::MemoryBlock state;
+
+        if (! settings.presetFile.loadFileAsData(state))
+            return juce::Result::fail("Couldn't read " + settings.presetFile.getFullPathName());
+
+        processor.setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+    }
+
+    for (auto& id : settings.parameters.getAllKeys()) {
+        juce::AudioProcessorParameter* found = nullptr;
+
+        for (auto* parameter : processor.getParameters())
+            if (auto* parameterWithId = dynamic_cast<juce::AudioProcessorParameterWithID*>(parameter))
+                if (parameterWithId->paramID == id)
+                    found = parameter;
+
+        if (found == nullptr)
+            return juce::Result::fail("No parameter called " + id);
+
+        found->setValueNotifyingHost(found->getValueForText(settings.parameters[id]));
+    }
+
+    return juce::Result::ok();
+}
+
+juce::Result OfflineRenderer::renderFile(juce::AudioProcessor& processor, const juce::File& input, const juce::File& output)
+{
+    if (output == input)
+        return juce::Result::fail("Would overwrite its input, set an output directory or suffix");
+
+    std::unique_ptr<juce::AudioFormatReader> reader (formatManager.createReaderFor(input));
+
+    if (reader == nullptr)
+        return juce::Result::fail("Couldn't read " + input.getFullPathName());
+
+    auto numChannels = static_cast<int>(reader->numChannels);
+    auto sampleRate = reader->sampleRate;
+    auto length = reader->lengthInSamples;
+
+    if (! configure(processor, sampleRate, numChannels))
+        return juce::Result::fail(processor.getName() + " doesn't support " + juce::String(numChannels) + " channels");
+
+    auto* format = formatManager.findFormatForFileExtension(output.getFileExtension());
+
+    if (format == nullptr)
+        return juce::Result::fail("No format writes " + output.getFileExtension() + " files");
+
+    //The input's depth if the output format has it, otherwise the deepest it does
+    auto bitDepths = format->getPossibleBitDepths();
+    auto bitDepth = settings.bitDepth > 0 ? settings.bitDepth : static_cast<int>(reader->bitsPerSample);
+
+    if (! bitDepths.contains(bitDepth))
+        bitDepth = bitDepths.getLast();
+
+    //Metadata only carries over between files of the same format
+    auto metadata = format->getFormatName() == reader->getFormatName() ? reader->metadataValues : juce::StringPairArray();
+
+    output.deleteFile();
+    std::unique_ptr<juce::OutputStream> stream (output.createOutputStream());
+
+    if (stream == nullptr)
+        return juce::Result::fail("Couldn't create " + output.getFullPathName());
+
+    std::unique_ptr<juce::AudioFormatWriter> writer (format->createWriterFor(stream.get(), sampleRate, static_cast<unsigned int>(numChannels),
+                                                                             bitDepth, metadata, 0));
+
+    if (writer == nullptr)
+        return juce::Result::fail("Couldn't write " + juce::String(numChannels) + " channels at " + juce::String(bitDepth) + " bits to "
+                                  + output.getFullPathName());
+
+    //The writer owns it now
+    stream.release();
+
+    //Chunks hold whole blocks, around chunkBytes each however many channels there are
+    auto blockSize = settings.blockSize;
+    auto blocksPerChunk = settings.chunkBytes / (sizeof(float) * static_cast<size_t>(numChannels) * static_cast<size_t>(blockSize));
+    auto chunkSize = blockSize * static_cast<int>(juce::jlimit<size_t>(1, 1024, blocksPerChunk));
+
+    //getTailLengthSeconds can be infinite
+    auto tailSeconds = settings.truncateTail ? 0.0 : juce::jlimit(0.0, settings.maxTailSeconds, processor.getTailLengthSeconds());
+    auto tailSamples = static_cast<juce::int64>(std::ceil(tailSeconds * sampleRate));
+
+    //Declared after the writer so it's gone before the writer is
+    ChunkPipeline pipeline(*reader, *writer, chunkSize, processor.getLatencySamples(), tailSamples);
+
+    auto useDoublePrecision = processor.isUsingDoublePrecision();
+    juce::AudioBuffer<double> doubleBuffer(useDoublePrecision ? numChannels : 0, useDoublePrecision ? blockSize : 0);
+    juce::MidiBuffer midiMessages;
+
+    while (auto* chunk = pipeline.getNextInput()) {
+        for (int start = 0; start < chunk->numSamples; start += blockSize) {
+            auto numSamples = juce::jmin(blockSize, chunk->numSamples - start);
+
+            //Refers into the chunk, nothing's copied
+            juce::AudioBuffer<float> block(chunk->buffer.getArrayOfWritePointers(), numChannels, start, numSamples);
+            midiMessages.clear();
+
+            if (useDoublePrecision) {
+                doubleBuffer.setSize(numChannels, numSamples, false, false, true);
+
+                for (int channel = 0; channel < numChannels; ++channel)
+                    std::copy_n(block.getReadPointer(channel), numSamples, doubleBuffer.getWritePointer(channel));
+
+                processor.processBlock(doubleBuffer, midiMessages);
+
+                for (int channel = 0; channel < numChannels; ++channel)
+                    std::copy_n(doubleBuffer.getReadPointer(channel), numSamples, block.getWritePointer(channel));
+            } else {
+                processor.processBlock(block, midiMessages);
+            }
+        }
+
+        pipeline.submitOutput(chunk);
+    }
+
+    return pipeline.finish();
+}
+
+bool OfflineRenderer::configure(juce::AudioProcessor& processor, double sampleRate, int numChannels)
+{
+    processor.releaseResources();
+
+    auto channelSet = juce::AudioChannelSet::canonicalChannelSet(numChannels);
+    juce::AudioProcessor::BusesLayout layout;
+    layout.inputBuses.add(channelSet);
+    layout.outputBuses.add(channelSet);
+
+    if (! processor.setBusesLayout(layout))
+        return false;
+
+    auto precision = settings.useDoublePrecision && processor.supportsDoublePrecisionProcessing()
+                   ? juce::AudioProcessor::doublePrecision : juce::AudioProcessor::singlePrecision;
+
+    processor.setProcessingPrecision(precision);
+    processor.setNonRealtime(true);
+    processor.setRateAndBufferSizeDetails(sampleRate, settings.blockSize);
+    processor.prepareToPlay(sampleRate, settings.blockSize);
+    return true;
+}
+
+juce::AudioProcessor* OfflineRenderer::acquireProcessor()
+{
+    const juce::ScopedLock lock(processorLock);
+    jassert(! freeProcessors.isEmpty());
+    return freeProcessors.removeAndReturn(freeProcessors.size() - 1);
+}
+
+void OfflineRenderer::releaseProcessor(juce::AudioProcessor* processor)
+{
+    const juce::ScopedLock lock(processorLock);
+    freeProcessors.add(processor);
+}
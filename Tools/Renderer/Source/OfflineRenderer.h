@@ -0,0 +1,109 @@
+/*
+  ==============================================================================
+
+    OfflineRenderer.h
+
+    Runs audio files through an AudioProcessor headlessly and writes the
+    results, several files at once on a thread pool. Every worker has its own
+    processor instance, set up once with the same state and parameters.
+    Files are streamed through a ChunkPipeline, so reading and writing happen
+    alongside the processing and memory doesn't grow with file length.
+
+    The processor's reported latency is compensated, output files line up
+    with their inputs. They run on past the input's end for the processor's
+    reported tail (getTailLengthSeconds) unless truncateTail is set, which
+    keeps them the same length as the input.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+struct RenderSettings
+{
+    //Files at once, each on its own processor instance
+    int numThreads = juce::jmax(1, juce::SystemStats::getNumCpus());
+
+    //Samples per processBlock, large since nothing here is real time
+    int blockSize = 8192;
+
+    //Roughly how much audio each chunk holds. Three are in flight per file, one being read,
+    //one processed and one written, so this and the thread count set the memory used
+    size_t chunkBytes = 1 << 20;
+
+    //Run the processor's double precision processBlock when it has one
+    bool useDoublePrecision = false;
+
+    //A state blob as saved by getStateInformation, applied before the parameters below
+    juce::File presetFile;
+
+    //Parameter IDs and values as they'd be typed into the host, e.g. "drive" -> "12"
+    //or "oversampling" -> "4x", see AudioProcessorParameter::getValueForText
+    juce::StringPairArray parameters;
+
+    //Empty writes next to each input
+    juce::File outputDirectory;
+    juce::String outputSuffix;
+
+    //File extension of the format to write (".wav", ".aiff", ".flac"), empty keeps the input's
+    juce::String outputFormat;
+
+    //0 keeps the input's, falling back to the nearest the output format can write
+    int bitDepth = 0;
+
+    //Cut the output at the input's length, dropping whatever the processor rings on for
+    bool truncateTail = false;
+
+    //Longest tail rendered, for processors that report an endless one
+    double maxTailSeconds = 60.0;
+};
+
+class OfflineRenderer
+{
+public:
+    using ProcessorFactory = std::function<std::unique_ptr<juce::AudioProcessor>()>;
+
+    OfflineRenderer(ProcessorFactory factory, RenderSettings settings);
+    ~OfflineRenderer();
+
+    //Creates the processors and applies the preset and parameters, fails if any of them can't be
+    juce::Result initialise();
+
+    //Renders every file, blocking until they're all done. onFinished is called from
+    //the worker threads (one at a time) as each file completes
+    int render(const juce::Array<juce::File>& inputs,
+               std::function<void(const juce::File& input, const juce::File& output, const juce::Result& result)> onFinished = nullptr);
+
+    //Where an input's render goes with these settings
+    juce::File getOutputFile(const juce::File& input) const;
+
+    //id: name, range and current text of every parameter, for --list-parameters
+    static juce::StringArray describeParameters(juce::AudioProcessor& processor);
+
+private:
+
+    struct Batch;
+    class RenderJob;
+
+    juce::Result applySettings(juce::AudioProcessor& processor) const;
+    juce::Result renderFile(juce::AudioProcessor& processor, const juce::File& input, const juce::File& output);
+
+    bool configure(juce::AudioProcessor& processor, double sampleRate, int numChannels);
+
+    //Worker side of the processor pool, one is always free for a running job
+    juce::AudioProcessor* acquireProcessor();
+    void releaseProcessor(juce::AudioProcessor* processor);
+
+    ProcessorFactory factory;
+    RenderSettings settings;
+
+    juce::AudioFormatManager formatManager;
+
+    std::vector<std::unique_ptr<juce::AudioProcessor>> processors;
+    juce::Array<juce::AudioProcessor*> freeProcessors;
+    juce::CriticalSection processorLock;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (OfflineRenderer)
+};
@@ -0,0 +1,318 @@
+/*
+  ==============================================================================
+
+    Main.cpp
+
+    Checks the pedal's convolution against a plain direct form convolution,
+    and that .pir files survive a write and open and are turned down when
+    they're cut short. Exits with 1 if anything fails, so it can be run by
+    ctest or by hand.
+
+    Usage:
+      PedalSelfCheck [--verbose]
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "PartitionedImpulseResponseFile.h"
+
+//Float FFTs against a double direct form, relative to the loudest reference sample
+static constexpr double tolerance = 1.0e-4;
+
+static bool verbose = false;
+static int numChecks = 0;
+static int numFailures = 0;
+
+static void check(bool passed, const juce::String& description)
+{
+    ++numChecks;
+
+    if (! passed)
+        ++numFailures;
+
+    if (! passed || verbose)
+        std::cout << (passed ? "  ok    " : "  FAIL  ") << description.toStdString() << std::endl;
+}
+
+//Decaying noise, so every partition of a long IR has something in it
+static juce::AudioBuffer<float> makeImpulseResponse(int numChannels, int length, juce::Random& random)
+{
+    juce::AudioBuffer<float> impulseResponse(numChannels, length);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        for (int sample = 0; sample < length; ++sample)
+            impulseResponse.setSample(channel, sample, (random.nextFloat() * 2.0f - 1.0f) * std::exp(-3.0f * static_cast<float>(sample) / static_cast<float>(length)));
+
+    return impulseResponse;
+}
+
+static juce::AudioBuffer<float> makeNoise(int numChannels, int length, juce::Random& random)
+{
+    juce::AudioBuffer<float> noise(numChannels, length);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        for (int sample = 0; sample < length; ++sample)
+            noise.setSample(channel, sample, random.nextFloat() * 2.0f - 1.0f);
+
+    return noise;
+}
+
+//Channel n through IR channel n or the last one, as the convolver does
+static juce::AudioBuffer<float> convolveDirect(const juce::AudioBuffer<float>& input, const juce::AudioBuffer<float>& impulseResponse)
+{
+    auto numSamples = input.getNumSamples();
+    juce::AudioBuffer<float> output(input.getNumChannels(), numSamples);
+
+    for (int channel = 0; channel < input.getNumChannels(); ++channel) {
+        auto* in = input.getReadPointer(channel);
+        auto* taps = impulseResponse.getReadPointer(juce::jmin(channel, impulseResponse.getNumChannels() - 1));
+        auto* out = output.getWritePointer(channel);
+
+        for (int sample = 0; sample < numSamples; ++sample) {
+            double sum = 0.0;
+
+            for (int tap = 0; tap < impulseResponse.getNumSamples() && tap <= sample; ++tap)
+                sum += static_cast<double>(taps[tap]) * static_cast<double>(in[sample - tap]);
+
+            out[sample] = static_cast<float>(sum);
+        }
+    }
+
+    return output;
+}
+
+static juce::AudioBuffer<float> delay(const juce::AudioBuffer<float>& buffer, int numSamples)
+{
+    juce::AudioBuffer<float> delayed(buffer.getNumChannels(), buffer.getNumSamples());
+    delayed.clear();
+
+    for (int channel = 0; channel < buffer.getNumChannels() && numSamples < buffer.getNumSamples(); ++channel)
+        delayed.copyFrom(channel, numSamples, buffer, channel, 0, buffer.getNumSamples() - numSamples);
+
+    return delayed;
+}
+
+//Runs the input through in blocks of blockSize, which may be more than the convolver's maximum
+static juce::AudioBuffer<float> convolve(PartitionedConvolver& convolver, const juce::AudioBuffer<float>& input, int blockSize)
+{
+    juce::AudioBuffer<float> output(input);
+    juce::dsp::AudioBlock<float> block(output);
+
+    for (int start = 0; start < output.getNumSamples(); start += blockSize)
+        convolver.process(block.getSubBlock(static_cast<size_t>(start), static_cast<size_t>(juce::jmin(blockSize, output.getNumSamples() - start))));
+
+    return output;
+}
+
+//Largest difference relative to the reference's peak
+static double getError(const juce::AudioBuffer<float>& output, const juce::AudioBuffer<float>& reference)
+{
+    double peak = 0.0, error = 0.0;
+
+    for (int channel = 0; channel < reference.getNumChannels(); ++channel) {
+        for (int sample = 0; sample < reference.getNumSamples(); ++sample) {
+            peak = juce::jmax(peak, std::abs(static_cast<double>(reference.getSample(channel, sample))));
+            error = juce::jmax(error, std::abs(static_cast<double>(output.getSample(channel, sample)) - reference.getSample(channel, sample)));
+        }
+    }
+
+    return peak > 0.0 ? error / peak : error;
+}
+
+static juce::String describe(const PartitionedConvolver::Layout& layout)
+{
+    juce::String text = "latency " + juce::String(layout.latency) + ", stages";
+
+    for (const auto& stage : layout.stages)
+        text << " " << stage.blockSize << "@" << stage.offset;
+
+    return text;
+}
+
+//==============================================================================
+//The presets, then layouts for the cases they don't reach: a head that isn't a whole
+//number of blocks and stages starting past their latency, which skip whole partitions
+static std::vector<PartitionedConvolver::Layout> getLayoutsToCheck()
+{
+    std::vector<PartitionedConvolver::Layout> layouts;
+
+    for (int preset = PartitionedConvolver::zeroLatency; preset <= PartitionedConvolver::throughput; ++preset)
+        layouts.push_back(PartitionedConvolver::getPresetLayout(static_cast<PartitionedConvolver::Preset>(preset)));
+
+    layouts.push_back({0, {{64, 100}, {256, 612}}});
+    layouts.push_back({32, {{32, 0}, {128, 512}}});
+    layouts.push_back({0, {{16, 16}, {64, 300}, {512, 1500}}});
+    layouts.push_back({100, {{64, 0}, {256, 1000}}});
+
+    return layouts;
+}
+
+static void checkConvolver(juce::Random& random)
+{
+    std::cout << "PartitionedConvolver against direct convolution" << std::endl;
+
+    struct Case
+    {
+        int irChannels;
+        int irLength;
+        int numChannels;
+        int channelsPerGroup;
+    };
+
+    //Direct form only, a single partition's worth, several partitions, mono on stereo,
+    //stereo on three channels and one channel per group
+    const Case cases[] = {
+        {1, 100, 1, 0},
+        {1, 700, 2, 0},
+        {2, 3000, 2, 0},
+        {2, 3000, 3, 1}
+    };
+
+    const int blockSizes[] = {1, 64, 437};
+    const int maximumBlockSize = 256;
+
+    for (const auto& testCase : cases) {
+        auto impulseResponse = makeImpulseResponse(testCase.irChannels, testCase.irLength, random);
+        auto input = makeNoise(testCase.numChannels, testCase.irLength + 5000, random);
+        auto undelayed = convolveDirect(input, impulseResponse);
+
+        for (const auto& layout : getLayoutsToCheck()) {
+            //Also checks chooseLayout's direct form for short IRs
+            auto filter = std::make_shared<const PartitionedConvolver::Filter>(impulseResponse, PartitionedConvolver::chooseLayout(layout, testCase.irLength));
+            auto reference = delay(undelayed, filter->getLayout().latency);
+
+            for (auto blockSize : blockSizes) {
+                PartitionedConvolver convolver(filter, maximumBlockSize, testCase.numChannels, testCase.channelsPerGroup);
+                auto error = getError(convolve(convolver, input, blockSize), reference);
+
+                check(error < tolerance, describe(layout) + ": " + juce::String(testCase.irChannels) + " x " + juce::String(testCase.irLength)
+                                         + " IR on " + juce::String(testCase.numChannels) + " channels, blocks of " + juce::String(blockSize)
+                                         + ", error " + juce::String(error));
+            }
+
+            //Reset has to leave nothing of the last run behind
+            PartitionedConvolver convolver(filter, maximumBlockSize, testCase.numChannels, testCase.channelsPerGroup);
+            convolve(convolver, makeNoise(testCase.numChannels, 4000, random), 64);
+            convolver.reset();
+
+            auto error = getError(convolve(convolver, input, 64), reference);
+            check(error < tolerance, describe(layout) + ": " + juce::String(testCase.irLength) + " IR after reset, error " + juce::String(error));
+        }
+    }
+}
+
+//==============================================================================
+static bool writeTruncated(const juce::File& source, const juce::File& destination, juce::int64 numBytes)
+{
+    juce::MemoryBlock data;
+
+    if (! source.loadFileAsData(data))
+        return false;
+
+    return destination.replaceWithData(data.getData(), static_cast<size_t>(juce::jmin(numBytes, static_cast<juce::int64>(data.getSize()))));
+}
+
+static void checkFile(juce::Random& random)
+{
+    std::cout << "PartitionedImpulseResponseFile round trip" << std::endl;
+
+    const double sampleRate = 48000.0;
+    const juce::Array<double> sampleRates { sampleRate };
+    std::vector<PartitionedConvolver::Layout> layouts;
+
+    for (int preset = PartitionedConvolver::zeroLatency; preset <= PartitionedConvolver::throughput; ++preset)
+        layouts.push_back(PartitionedConvolver::getPresetLayout(static_cast<PartitionedConvolver::Preset>(preset)));
+
+    //A short IR that ends up direct form whatever the layout, and a long stereo one
+    for (auto irLength : {100, 6000}) {
+        auto impulseResponse = makeImpulseResponse(irLength > 100 ? 2 : 1, irLength, random);
+        auto description = juce::String(impulseResponse.getNumChannels()) + " x " + juce::String(irLength) + " IR: ";
+
+        juce::TemporaryFile temporaryFile(PartitionedImpulseResponseFile::fileExtension);
+        auto file = temporaryFile.getFile();
+
+        //No trimming, normalising or resampling, so the filters are built from exactly this IR
+        if (! PartitionedImpulseResponseFile::write(file, impulseResponse, sampleRate, sampleRates, layouts, false, false)) {
+            check(false, description + "write");
+            continue;
+        }
+
+        auto partitionedFile = PartitionedImpulseResponseFile::open(file);
+
+        if (partitionedFile == nullptr) {
+            check(false, description + "open");
+            continue;
+        }
+
+        check(partitionedFile->getNumEntries() == static_cast<int>(layouts.size()), description + "one entry per layout");
+        check(juce::approximatelyEqual(partitionedFile->getSourceSampleRate(), sampleRate), description + "source sample rate");
+        check(! partitionedFile->isTrimmed() && ! partitionedFile->isNormalised(), description + "flags");
+
+        auto source = partitionedFile->getSourceImpulseResponse();
+        auto sourceMatches = source.getNumChannels() == impulseResponse.getNumChannels() && source.getNumSamples() == irLength;
+
+        for (int channel = 0; channel < source.getNumChannels() && sourceMatches; ++channel)
+            sourceMatches = std::memcmp(source.getReadPointer(channel), impulseResponse.getReadPointer(channel), static_cast<size_t>(irLength) * sizeof(float)) == 0;
+
+        check(sourceMatches, description + "source samples");
+        check(partitionedFile->getFilter(44100.0, layouts.front()) == nullptr, description + "no filter for a rate that wasn't built");
+
+        //The mapped filter holds the same taps and spectra as one built from the IR, so it has to convolve the same
+        auto input = makeNoise(2, irLength + 5000, random);
+
+        for (const auto& layout : layouts) {
+            auto filter = partitionedFile->getFilter(sampleRate, layout);
+
+            if (filter == nullptr) {
+                check(false, description + describe(layout) + ": filter");
+                continue;
+            }
+
+            PartitionedConvolver mapped(filter, 256, 2);
+            PartitionedConvolver built(impulseResponse, layout, 256, 2);
+            auto error = getError(convolve(mapped, input, 256), convolve(built, input, 256));
+
+            check(filter->getLayout() == PartitionedConvolver::chooseLayout(layout, irLength) && error < 1.0e-6,
+                  description + describe(layout) + ": mapped filter matches, error " + juce::String(error));
+        }
+
+        //Files end on a 64 byte boundary with less than that of padding, so losing 64 bytes always
+        //cuts into the last array. Shorter still the entries or the header itself go missing
+        juce::TemporaryFile truncatedFile(PartitionedImpulseResponseFile::fileExtension);
+        auto fileSize = file.getSize();
+
+        for (auto numBytes : {fileSize - 64, fileSize / 2, static_cast<juce::int64>(100), static_cast<juce::int64>(8)}) {
+            if (! writeTruncated(file, truncatedFile.getFile(), numBytes)) {
+                check(false, description + "writing a truncated copy");
+                continue;
+            }
+
+            check(PartitionedImpulseResponseFile::open(truncatedFile.getFile()) == nullptr,
+                  description + "truncated to " + juce::String(numBytes) + " of " + juce::String(fileSize) + " bytes is turned down");
+        }
+    }
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h")) {
+        std::cout << "Usage: " << args.executableName.toStdString() << " [--verbose]" << std::endl;
+        return 0;
+    }
+
+    verbose = args.containsOption("--verbose|-v");
+
+    //Fixed seed, so a failure shows up the same way every run
+    juce::Random random(0x5eed);
+
+    checkConvolver(random);
+    checkFile(random);
+
+    std::cout << numChecks - numFailures << " of " << numChecks << " checks passed" << std::endl;
+    return numFailures == 0 ? 0 : 1;
+}
@@ -23,6 +23,7 @@ ViatorDCDistortionAudioProcessor::ViatorDCDistortionAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 ViatorDCDistortionAudioProcessor::~ViatorDCDistortionAudioProcessor()
@@ -113,6 +114,8 @@ void ViatorDCDistortionAudioProcessor::changeProgramName (int index, const juce:
 //==============================================================================
 void ViatorDCDistortionAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    meter.prepare(sampleRate);
+    
     juce::dsp::ProcessSpec spec;
     spec.maximumBlockSize = samplesPerBlock;
     spec.sampleRate = sampleRate;
@@ -120,6 +123,12 @@ void ViatorDCDistortionAudioProcessor::prepareToPlay (double sampleRate, int sam
     
     inputGainProcessor.prepare(spec);
     outputGainProcessor.prepare(spec);
+    
+    //Built on first use, make sure that isn't the audio thread
+    ViatorDSP::DistortionEngine::DCDistortion::getTable();
+    
+    channelPacker.prepare(getTotalNumInputChannels(), samplesPerBlock);
+    silenceDetector.reset();
 }
 
 void ViatorDCDistortionAudioProcessor::releaseResources()
@@ -153,44 +162,51 @@ bool ViatorDCDistortionAudioProcessor::isBusesLayoutSupported (const BusesLayout
 #endif
 
 void ViatorDCDistortionAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void ViatorDCDistortionAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool ViatorDCDistortionAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void ViatorDCDistortionAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
     
+    //Silent in, and silent out last time, so there's nothing to shape
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        buffer.clear();
+        return;
+    }
+    
     auto* rawDrive = treeState.getRawParameterValue(driveSliderId);
     auto* rawInput = treeState.getRawParameterValue(inputSliderId);
     auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
-
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    {
-        auto* outputData = buffer.getWritePointer (channel);
-        auto* inputData = buffer.getReadPointer(channel);
-        
-        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-            
-            float dc = scaleRange(*rawInput, 0.0f, 24.0f, 0.75f, 1.0f);
-            float x = (inputData[sample] * pow(10, *rawInput * 0.05f)) + dc;
-            float y;
-            
-            if (abs(x) > 1) {
-                x = sin(x);
-            }
-            
-            y = x - 0.2 * pow(x, 5);
-            
-            outputData[sample] = (y - dc) * pow(10, *rawTrim * 0.05f);
-        }
-
-    }
-}
-
-float ViatorDCDistortionAudioProcessor::scaleRange(float input, float inputLow, float inputHigh, float outputLow, float outputHigh){
-    return ((input - inputLow) / (inputHigh - inputLow)) * (outputHigh - outputLow) + outputLow;
-
+    
+    ViatorDSP::DistortionEngine::Coefficients coefficients;
+    coefficients.bias = ViatorDSP::scaleRange(*rawInput, 0.0f, 24.0f, 0.75f, 1.0f);
+    coefficients.inputGain = pow(10, *rawInput * 0.05f);
+    auto trimGain = static_cast<SampleType>(pow(10, *rawTrim * 0.05f));
+
+    juce::dsp::AudioBlock<SampleType> audioBlock (buffer);
+    auto inputChannels = audioBlock.getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+    channelPacker.process<ViatorDSP::DistortionEngine::DCDistortion>(inputChannels, coefficients, trimGain, static_cast<SampleType>(0));
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //==============================================================================
@@ -0,0 +1,160 @@
+/*
+  ==============================================================================
+
+    ChannelGroupWorkers.h
+
+    A few threads that help the audio thread through independent jobs, one
+    per group of channels, when a block is big enough for it to pay off.
+    run() hands the jobs out through one atomic counter, works on them itself
+    too and returns once the last one is done, so the caller sees an ordinary
+    blocking call and nothing is allocated or locked per block beyond the
+    wake up and the completion signal.
+
+    The workers are ordinary priority threads and run() waits for them, so
+    sharing is for offline rendering only (isNonRealtime()): a live audio
+    thread would stall behind whatever the scheduler put ahead of them. Waking
+    a thread also costs tens of microseconds at worst, more than a small
+    block takes, so even offline the jobs only go parallel above
+    minSamplesToShare and run in line otherwise.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace ViatorDSP
+{
+    class ChannelGroupWorkers
+    {
+    public:
+        //More threads than this fight the host's own workers for cores
+        static constexpr int maxWorkers = 3;
+
+        //Below this many samples per block the jobs run on the calling thread
+        static constexpr int minSamplesToShare = 1024;
+
+        ChannelGroupWorkers() = default;
+
+        ~ChannelGroupWorkers()
+        {
+            stop();
+        }
+
+        //Message thread, while the audio thread isn't running. Starts enough workers to share
+        //numJobs jobs with the caller, none for a single job
+        void prepare(int numJobs, std::function<void (int job)> jobToRun)
+        {
+            stop();
+            job = std::move(jobToRun);
+
+            auto numWorkers = juce::jmin(maxWorkers, numJobs - 1, juce::SystemStats::getNumCpus() - 1);
+
+            for (int index = 0; index < numWorkers; ++index) {
+                workers.push_back(std::make_unique<Worker>(*this));
+                workers.back()->startThread();
+            }
+        }
+
+        void stop()
+        {
+            for (auto& worker : workers)
+                worker->stop();
+
+            workers.clear();
+        }
+
+        //Only offline, see above
+        bool canShare(int numSamples, bool isNonRealtime) const noexcept
+        {
+            return isNonRealtime && ! workers.empty() && numSamples >= minSamplesToShare;
+        }
+
+        //Audio thread, calls job(0) to job(numJobs - 1), on the workers as well when shareWork is
+        //set, and returns once they've all finished
+        void run(int numJobs, bool shareWork) noexcept
+        {
+            if (! shareWork || workers.empty()) {
+                for (int index = 0; index < numJobs; ++index)
+                    job(index);
+
+                return;
+            }
+
+            totalJobs = numJobs;
+            remainingJobs.store(numJobs, std::memory_order_relaxed);
+            unclaimedJobs.store(numJobs, std::memory_order_release);
+
+            for (auto& worker : workers)
+                worker->wake.signal();
+
+            workOnJobs();
+            allDone.wait(-1);
+        }
+
+    private:
+
+        class Worker : public juce::Thread
+        {
+        public:
+            explicit Worker(ChannelGroupWorkers& ownerToUse)
+            : juce::Thread("Channel Group Worker"), owner(ownerToUse)
+            {
+            }
+
+            void stop()
+            {
+                signalThreadShouldExit();
+                wake.signal();
+                stopThread(2000);
+            }
+
+            void run() override
+            {
+                while (! threadShouldExit()) {
+                    wake.wait(-1);
+
+                    if (threadShouldExit())
+                        break;
+
+                    owner.workOnJobs();
+                }
+            }
+
+            juce::WaitableEvent wake;
+
+        private:
+            ChannelGroupWorkers& owner;
+        };
+
+        //Claims jobs until there are none left. A worker that wakes late finds nothing to claim,
+        //unclaimedJobs only goes above zero inside run()
+        void workOnJobs() noexcept
+        {
+            auto unclaimed = unclaimedJobs.load(std::memory_order_acquire);
+
+            while (unclaimed > 0) {
+                if (! unclaimedJobs.compare_exchange_weak(unclaimed, unclaimed - 1, std::memory_order_acq_rel))
+                    continue;
+
+                job(totalJobs - unclaimed);
+
+                if (remainingJobs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    allDone.signal();
+
+                unclaimed = unclaimedJobs.load(std::memory_order_acquire);
+            }
+        }
+
+        std::function<void (int job)> job;
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        int totalJobs = 0;
+        std::atomic<int> unclaimedJobs { 0 };
+        std::atomic<int> remainingJobs { 0 };
+        juce::WaitableEvent allDone;
+
+        JUCE_DECLARE_NON_COPYABLE (ChannelGroupWorkers)
+    };
+}
@@ -0,0 +1,953 @@
+/*
+  ==============================================================================
+
+    DistortionEngine.h
+
+    The shaping curves every plugin in this repo uses, one struct per model.
+    Each model knows how to turn a drive knob into its coefficients and how
+    to shape a single sample, and processChannel is compiled once per model
+    so the hot loop has no branching on the model type. processRegister is
+    the same curve on a whole SIMD register, see DistortionSIMD.h for the
+    approximations used.
+
+    processBlock runs a model over every channel of an AudioBlock with one
+    set of coefficients and an output gain, which is all most plugins need.
+    processBlockLinked shapes all of a block's channels by the loudest one
+    instead, for linked multichannel processing.
+    processChannelsMidSide shapes a stereo pair as mid and side, each with
+    its own coefficients, encoding and decoding in the same pass.
+    ChannelPacker does the same but can also interleave the channels so the
+    SIMD lanes run across them, picking whichever layout is faster on the
+    machine it's running on. Shaper wraps that up as a juce::dsp processor
+    for ProcessorChains.
+    Plugins with their own knob mappings fill in Coefficients directly
+    rather than going through makeCoefficients.
+
+    Models with a closed form antiderivative (soft clip, hard clip and the
+    rectifiers) can also run with first or second order antiderivative
+    anti-aliasing (ADAA), see processChannelAntiderivative. ADAA delays the
+    output by half a sample (first order) or one sample (second order).
+
+    processSample and the channel loops are templated on the sample type so
+    64-bit hosts run the same code in double. The SIMD registers are float
+    only, double always takes the scalar loop.
+
+    To add a model: write a new struct with makeCoefficients/processSample
+    (and processRegister, and the antiderivatives if it has them).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "DistortionSIMD.h"
+#include "LookupTableShaper.h"
+
+namespace ViatorDSP
+{
+    //Maps a knob range linearly onto another, either direction
+    inline float scaleRange(float input, float inputLow, float inputHigh, float outputLow, float outputHigh)
+    {
+        return ((input - inputLow) / (inputHigh - inputLow)) * (outputHigh - outputLow) + outputLow;
+    }
+
+namespace DistortionEngine
+{
+    //Everything the shaping functions derive from the drive knob, or the plugin's own knobs
+    struct Coefficients
+    {
+        float inputGain = 1.0f;
+        float outputGain = 1.0f;
+        float threshold = 1.0f;
+        float bias = 0.0f;
+    };
+
+    //ADAA orders, these match the Saturator's anti-aliasing parameter
+    enum AntialiasingMode
+    {
+        noAntialiasing = 0,
+        firstOrderAntialiasing = 1,
+        secondOrderAntialiasing = 2
+    };
+    
+    //One channel's history for the ADAA modes, in the curve's input domain (after inputGain)
+    struct AntiderivativeState
+    {
+        double x1 = 0.0, x2 = 0.0;
+        
+        //F1(x1) for first order, F2(x1) and the divided difference of x1, x2 for second order
+        double antiderivative1 = 0.0;
+        double antiderivative2 = 0.0;
+        double lastDifference = 0.0;
+    };
+    
+    struct SoftClip
+    {
+        static Coefficients makeCoefficients(float drive)
+        {
+            //1.5f to account for drop in gain from the saturation initial state
+            //pow(10, (-1 * drive) * 0.04f) to account for the increase in gain when the drive goes up
+            Coefficients coefficients;
+            coefficients.inputGain = pow(10, (drive * 4) * 0.05f);
+            coefficients.outputGain = (2 / juce::MathConstants<float>::pi) * 1.5f * pow(10, (-1 * drive) * 0.04f);
+            return coefficients;
+        }
+
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            return std::atan(static_cast<SampleType>(coefficients.inputGain) * input);
+        }
+
+       #if JUCE_USE_SIMD
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            return DistortionSIMD::atan(input * coefficients.inputGain);
+        }
+       #endif
+        
+        //f(u) = atan(u), u = inputGain * x
+        static constexpr bool hasAntiderivatives = true;
+        
+        static double curve(double u, const Coefficients &) noexcept
+        {
+            return std::atan(u);
+        }
+        
+        static double antiderivative1(double u, const Coefficients &) noexcept
+        {
+            return u * std::atan(u) - 0.5 * std::log1p(u * u);
+        }
+        
+        static double antiderivative2(double u, const Coefficients &) noexcept
+        {
+            return 0.5 * ((u * u - 1.0) * std::atan(u) + u - u * std::log1p(u * u));
+        }
+    };
+
+    struct HardClip
+    {
+        static Coefficients makeCoefficients(float drive)
+        {
+            Coefficients coefficients;
+            coefficients.threshold = scaleRange(drive, 0.0f, 24.0f, 1.0f, 0.0001f);
+            coefficients.outputGain = 1.5f * pow(10, drive * 0.04);
+            return coefficients;
+        }
+
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            auto threshold = static_cast<SampleType>(coefficients.threshold);
+            return juce::jlimit(-threshold, threshold, input);
+        }
+
+       #if JUCE_USE_SIMD
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            return DistortionSIMD::Vec::min(DistortionSIMD::Vec::max(input, DistortionSIMD::Vec::expand(-coefficients.threshold)),
+                                           DistortionSIMD::Vec::expand(coefficients.threshold));
+        }
+       #endif
+        
+        //f(u) = clamp(u, -t, t)
+        static constexpr bool hasAntiderivatives = true;
+        
+        static double curve(double u, const Coefficients &coefficients) noexcept
+        {
+            return juce::jlimit(-static_cast<double>(coefficients.threshold), static_cast<double>(coefficients.threshold), u);
+        }
+        
+        static double antiderivative1(double u, const Coefficients &coefficients) noexcept
+        {
+            double t = coefficients.threshold;
+            return std::abs(u) <= t ? 0.5 * u * u : t * std::abs(u) - 0.5 * t * t;
+        }
+        
+        static double antiderivative2(double u, const Coefficients &coefficients) noexcept
+        {
+            double t = coefficients.threshold;
+            
+            if (std::abs(u) <= t) {
+                return u * u * u / 6.0;
+            }
+            
+            double sign = u > 0.0 ? 1.0 : -1.0;
+            return sign * (0.5 * t * u * u + t * t * t / 6.0) - 0.5 * t * t * u;
+        }
+    };
+
+    struct DCDistortion
+    {
+        static Coefficients makeCoefficients(float drive)
+        {
+            Coefficients coefficients;
+            coefficients.inputGain = pow(10, drive * 0.05f);
+            coefficients.bias = scaleRange(drive, 0.0f, 24.0, 0.75f, 1.0f);
+            return coefficients;
+        }
+
+        //Past this the curve is clamped, well beyond any knob setting
+        static constexpr double maxInput = 32.0;
+
+        //The sin fold and x^5, the bias only shifts its input
+        static double curve(double x) noexcept
+        {
+            x = juce::jlimit(-maxInput, maxInput, x);
+
+            if (std::abs(x) > 1) {
+                x = std::sin(x);
+            }
+
+            double x2 = x * x;
+            return x - 0.2 * x2 * x2 * x;
+        }
+
+        //One table covers every instance and setting. 1024 segments over [-32, 32] put the
+        //fold at |x| = 1 on a segment edge. Fetch it once off the audio thread to build it
+        static const LookupTableShaper<float>& getTable()
+        {
+            static const auto table = [] {
+                LookupTableShaper<float> shaper;
+                shaper.build(curve, static_cast<float>(-maxInput), static_cast<float>(maxInput), 1024);
+                return shaper;
+            }();
+
+            return table;
+        }
+
+        //The table in float, the exact curve in double
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            auto bias = static_cast<SampleType>(coefficients.bias);
+            SampleType x = (input * static_cast<SampleType>(coefficients.inputGain)) + bias;
+
+            if constexpr (std::is_same<SampleType, float>::value) {
+                return getTable().processSample(x) - bias;
+            } else {
+                return static_cast<SampleType>(curve(x)) - bias;
+            }
+        }
+
+       #if JUCE_USE_SIMD
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            const auto limit = static_cast<float>(maxInput);
+            auto x = input * coefficients.inputGain + coefficients.bias;
+            x = DistortionSIMD::Vec::min(DistortionSIMD::Vec::max(x, DistortionSIMD::Vec::expand(-limit)), DistortionSIMD::Vec::expand(limit));
+
+            auto isOutside = DistortionSIMD::Vec::greaterThan(DistortionSIMD::abs(x), DistortionSIMD::Vec::expand(1.0f));
+            x = DistortionSIMD::select(isOutside, DistortionSIMD::sin(x), x);
+
+            auto x2 = x * x;
+            return (x - x2 * x2 * x * 0.2f) - coefficients.bias;
+        }
+       #endif
+        
+        static constexpr bool hasAntiderivatives = false;
+    };
+
+    //exp(u) - 1, the Shockley diode law with the saturation current left to the output gain.
+    //inputGain is 1 / (n * Vt) and whatever pad goes in front of the diode
+    struct Diode
+    {
+        static Coefficients makeCoefficients(float)
+        {
+            //1 / (n * Vt) with the 0.1 input pad folded in
+            Coefficients coefficients;
+            coefficients.inputGain = 0.1 / (1.68 * 0.0253);
+            coefficients.outputGain = 0.105f;
+            return coefficients;
+        }
+
+        //u is clamped here, exp(16) is already far past anything a speaker should see
+        static constexpr double maxInput = 16.0;
+
+        static double curve(double u) noexcept
+        {
+            return std::expm1(juce::jlimit(-maxInput, maxInput, u));
+        }
+
+        //The curve is over u, so the gains only scale the table's input and every instance
+        //shares one. Fetch it once off the audio thread to build it
+        static const LookupTableShaper<float>& getTable()
+        {
+            static const auto table = [] {
+                LookupTableShaper<float> shaper;
+                shaper.build(curve, static_cast<float>(-maxInput), static_cast<float>(maxInput));
+                return shaper;
+            }();
+            
+            return table;
+        }
+        
+        //The table in float, in double the exact curve: exp(u) - 1 is where float loses the most.
+        //Both go through curve's clamp to +-maxInput, so the two precisions agree past it too
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            auto u = input * static_cast<SampleType>(coefficients.inputGain);
+
+            if constexpr (std::is_same<SampleType, float>::value) {
+                return getTable().processSample(u);
+            } else {
+                return static_cast<SampleType>(curve(u));
+            }
+        }
+
+       #if JUCE_USE_SIMD
+        //Clamped to +-maxInput before the exp like curve and the table, so registers and single samples agree everywhere
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            const auto limit = static_cast<float>(maxInput);
+            auto u = DistortionSIMD::Vec::min(DistortionSIMD::Vec::max(input * coefficients.inputGain, DistortionSIMD::Vec::expand(-limit)),
+                                              DistortionSIMD::Vec::expand(limit));
+            return DistortionSIMD::exp(u) - 1.0f;
+        }
+       #endif
+        
+        static constexpr bool hasAntiderivatives = false;
+    };
+
+    struct FullWaveRect
+    {
+        static Coefficients makeCoefficients(float)
+        {
+            return {};
+        }
+
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            return std::abs(input * static_cast<SampleType>(coefficients.inputGain));
+        }
+
+       #if JUCE_USE_SIMD
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            return DistortionSIMD::abs(input * coefficients.inputGain);
+        }
+       #endif
+        
+        //f(u) = |u|
+        static constexpr bool hasAntiderivatives = true;
+        
+        static double curve(double u, const Coefficients &) noexcept
+        {
+            return std::abs(u);
+        }
+        
+        static double antiderivative1(double u, const Coefficients &) noexcept
+        {
+            return 0.5 * u * std::abs(u);
+        }
+        
+        static double antiderivative2(double u, const Coefficients &) noexcept
+        {
+            return u * u * std::abs(u) / 6.0;
+        }
+    };
+
+    struct HalfWaveRect
+    {
+        static Coefficients makeCoefficients(float)
+        {
+            return {};
+        }
+
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            return juce::jmax(static_cast<SampleType>(0), input * static_cast<SampleType>(coefficients.inputGain));
+        }
+
+       #if JUCE_USE_SIMD
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            return DistortionSIMD::Vec::max(input * coefficients.inputGain, DistortionSIMD::Vec::expand(0.0f));
+        }
+       #endif
+
+        //f(u) = max(u, 0)
+        static constexpr bool hasAntiderivatives = true;
+
+        static double curve(double u, const Coefficients &) noexcept
+        {
+            return juce::jmax(0.0, u);
+        }
+
+        static double antiderivative1(double u, const Coefficients &) noexcept
+        {
+            return u > 0.0 ? 0.5 * u * u : 0.0;
+        }
+
+        static double antiderivative2(double u, const Coefficients &) noexcept
+        {
+            return u > 0.0 ? u * u * u / 6.0 : 0.0;
+        }
+    };
+
+    struct Tanh
+    {
+        static Coefficients makeCoefficients(float drive)
+        {
+            Coefficients coefficients;
+            coefficients.inputGain = pow(10, drive * 0.05f);
+            return coefficients;
+        }
+
+        template <typename SampleType>
+        static SampleType processSample(SampleType input, const Coefficients &coefficients) noexcept
+        {
+            return std::tanh(input * static_cast<SampleType>(coefficients.inputGain));
+        }
+
+       #if JUCE_USE_SIMD
+        static DistortionSIMD::Vec processRegister(DistortionSIMD::Vec input, const Coefficients &coefficients) noexcept
+        {
+            return DistortionSIMD::tanh(input * coefficients.inputGain);
+        }
+       #endif
+
+        static constexpr bool hasAntiderivatives = false;
+    };
+
+    //Scalar loop over [startSample, endSample), the gain ramp is indexed from the start of the span
+    template <typename Model, typename SampleType>
+    void processSamples(SampleType* data, int startSample, int endSample, const Coefficients &coefficients, SampleType gainStart, SampleType gainIncrement) noexcept
+    {
+        if (gainIncrement == 0) {
+            for (int sample = startSample; sample < endSample; ++sample)
+                data[sample] = Model::processSample(data[sample], coefficients) * gainStart;
+            return;
+        }
+
+        for (int sample = startSample; sample < endSample; ++sample)
+            data[sample] = Model::processSample(data[sample], coefficients) * (gainStart + gainIncrement * static_cast<SampleType>(sample + 1));
+    }
+
+    //Shapes one contiguous channel span and applies the output gain ramp,
+    //the ramp ends exactly on gainStart + gainIncrement * numSamples
+    template <typename Model, typename SampleType>
+    void processChannel(SampleType* data, int numSamples, const Coefficients &coefficients, SampleType gainStart, SampleType gainIncrement, bool vectorised) noexcept
+    {
+        int sample = 0;
+
+       #if JUCE_USE_SIMD
+        //The registers are float, double runs the scalar loop below
+        if constexpr (std::is_same<SampleType, float>::value) {
+            if (vectorised) {
+                using Vec = DistortionSIMD::Vec;
+                constexpr int width = static_cast<int>(Vec::SIMDNumElements);
+
+                //Scalar samples up to the first aligned address, then whole registers
+                int alignedStart = juce::jmin(static_cast<int>(Vec::getNextSIMDAlignedPtr(data) - data), numSamples);
+                processSamples<Model, SampleType>(data, 0, alignedStart, coefficients, gainStart, gainIncrement);
+
+                Vec laneRamp;
+                for (int lane = 0; lane < width; ++lane)
+                    laneRamp.set(static_cast<size_t>(lane), gainIncrement * static_cast<float>(lane + 1));
+
+                for (sample = alignedStart; sample + width <= numSamples; sample += width) {
+                    auto gain = laneRamp + (gainStart + gainIncrement * static_cast<float>(sample));
+                    auto output = Model::processRegister(Vec::fromRawArray(data + sample), coefficients) * gain;
+                    output.copyToRawArray(data + sample);
+                }
+            }
+        } else {
+            juce::ignoreUnused(vectorised);
+        }
+       #else
+        juce::ignoreUnused(vectorised);
+       #endif
+
+        //Whatever is left over, or everything when SIMD isn't available
+        processSamples<Model, SampleType>(data, sample, numSamples, coefficients, gainStart, gainIncrement);
+    }
+    
+    //Every channel of the block with the same coefficients and a fixed output gain
+    template <typename Model, typename SampleType>
+    void processBlock(const juce::dsp::AudioBlock<SampleType>& block, const Coefficients &coefficients, SampleType gain,
+                      bool vectorised = DistortionSIMD::isAvailable()) noexcept
+    {
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+            processChannel<Model, SampleType>(block.getChannelPointer(channel), static_cast<int>(block.getNumSamples()),
+                                              coefficients, gain, static_cast<SampleType>(0), vectorised);
+    }
+
+    //Scalar mid/side loop over [startSample, endSample), see processChannelsMidSide
+    template <typename Model, typename SampleType>
+    void processSamplesMidSide(SampleType* left, SampleType* right, int startSample, int endSample, const Coefficients &midCoefficients,
+                               const Coefficients &sideCoefficients, SampleType sideGain, SampleType gainStart, SampleType gainIncrement) noexcept
+    {
+        const auto half = static_cast<SampleType>(0.5);
+        const auto sideOffset = Model::processSample(static_cast<SampleType>(0), sideCoefficients);
+        
+        for (int sample = startSample; sample < endSample; ++sample) {
+            auto mid = Model::processSample((left[sample] + right[sample]) * half, midCoefficients);
+            auto side = (Model::processSample((left[sample] - right[sample]) * half, sideCoefficients) - sideOffset) * sideGain;
+            auto gain = gainStart + gainIncrement * static_cast<SampleType>(sample + 1);
+            
+            left[sample] = (mid + side) * gain;
+            right[sample] = (mid - side) * gain;
+        }
+    }
+    
+    //A stereo pair through mid/side in one pass, in place: each pair of samples is encoded, mid and
+    //side are shaped with their own coefficients and decoded straight back over the inputs, with
+    //nothing held in between. sideGain scales the shaped side before decoding (its makeup relative
+    //to the mid's) and the gain ramp is processChannel's, on both channels. The side curve's output
+    //at zero is taken off, so a centred source (no side) still comes out with L = R; an offset on
+    //the mid lands on both channels alike, as it would shaping them independently.
+    //The registers need both pointers aligned at the same sample, which AudioBuffer's channels are,
+    //otherwise the whole span takes the scalar loop
+    template <typename Model, typename SampleType>
+    void processChannelsMidSide(SampleType* left, SampleType* right, int numSamples, const Coefficients &midCoefficients, const Coefficients &sideCoefficients,
+                                SampleType sideGain, SampleType gainStart, SampleType gainIncrement, bool vectorised = DistortionSIMD::isAvailable()) noexcept
+    {
+        int sample = 0;
+        
+       #if JUCE_USE_SIMD
+        if constexpr (std::is_same<SampleType, float>::value) {
+            using Vec = DistortionSIMD::Vec;
+            constexpr int width = static_cast<int>(Vec::SIMDNumElements);
+            
+            auto leftOffset = static_cast<int>(Vec::getNextSIMDAlignedPtr(left) - left);
+            auto rightOffset = static_cast<int>(Vec::getNextSIMDAlignedPtr(right) - right);
+            
+            if (vectorised && leftOffset == rightOffset) {
+                int alignedStart = juce::jmin(leftOffset, numSamples);
+                processSamplesMidSide<Model, SampleType>(left, right, 0, alignedStart, midCoefficients, sideCoefficients, sideGain, gainStart, gainIncrement);
+                
+                Vec laneRamp;
+                for (int lane = 0; lane < width; ++lane)
+                    laneRamp.set(static_cast<size_t>(lane), gainIncrement * static_cast<float>(lane + 1));
+                
+                //From the register curve, which can differ from the scalar one in the last bits
+                auto sideOffset = Model::processRegister(Vec::expand(0.0f), sideCoefficients);
+                
+                for (sample = alignedStart; sample + width <= numSamples; sample += width) {
+                    auto leftIn = Vec::fromRawArray(left + sample);
+                    auto rightIn = Vec::fromRawArray(right + sample);
+                    auto mid = Model::processRegister((leftIn + rightIn) * 0.5f, midCoefficients);
+                    auto side = (Model::processRegister((leftIn - rightIn) * 0.5f, sideCoefficients) - sideOffset) * sideGain;
+                    auto gain = laneRamp + (gainStart + gainIncrement * static_cast<float>(sample));
+                    
+                    ((mid + side) * gain).copyToRawArray(left + sample);
+                    ((mid - side) * gain).copyToRawArray(right + sample);
+                }
+            }
+        } else {
+            juce::ignoreUnused(vectorised);
+        }
+       #else
+        juce::ignoreUnused(vectorised);
+       #endif
+        
+        processSamplesMidSide<Model, SampleType>(left, right, sample, numSamples, midCoefficients, sideCoefficients, sideGain, gainStart, gainIncrement);
+    }
+    
+    //Whether the curve puts out anything for silence, past what the tables round zero to
+    template <typename Model>
+    bool hasOffsetAtZero(const Coefficients &coefficients) noexcept
+    {
+        return std::abs(Model::processSample(0.0, coefficients)) > 1.0e-6;
+    }
+    
+    //Every channel through one shared gain, like a linked compressor: at each sample the input of
+    //whichever channel is loudest (the key) goes through the curve and every channel is scaled by
+    //output / key, so the balance between channels holds however hard it's driven. No channel is
+    //louder than the key, so none comes out louder than the curve would make it.
+    //A curve with an offset at zero (DC distortion) would come out as offset * data / key on every
+    //channel, noise as loud as the offset wherever the input is quiet, so those shape each channel
+    //on its own instead, the same as processChannel.
+    //key and shaped are scratch of at least numSamples each, the curve runs over shaped with the
+    //same gain ramp and vectorised loop as processChannel
+    template <typename Model, typename SampleType>
+    void processBlockLinked(const juce::dsp::AudioBlock<SampleType>& block, SampleType* key, SampleType* shaped, const Coefficients &coefficients,
+                            SampleType gainStart, SampleType gainIncrement, bool vectorised = DistortionSIMD::isAvailable()) noexcept
+    {
+        auto numSamples = static_cast<int>(block.getNumSamples());
+        
+        if (hasOffsetAtZero<Model>(coefficients)) {
+            for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+                processChannel<Model, SampleType>(block.getChannelPointer(channel), numSamples, coefficients, gainStart, gainIncrement, vectorised);
+            
+            return;
+        }
+        
+        std::copy_n(block.getChannelPointer(0), numSamples, key);
+        
+        for (size_t channel = 1; channel < block.getNumChannels(); ++channel) {
+            auto* data = block.getChannelPointer(channel);
+            
+            for (int sample = 0; sample < numSamples; ++sample)
+                key[sample] = std::abs(data[sample]) > std::abs(key[sample]) ? data[sample] : key[sample];
+        }
+        
+        std::copy_n(key, numSamples, shaped);
+        processChannel<Model, SampleType>(shaped, numSamples, coefficients, gainStart, gainIncrement, vectorised);
+        
+        for (int sample = 0; sample < numSamples; ++sample)
+            shaped[sample] = key[sample] != static_cast<SampleType>(0) ? shaped[sample] / key[sample] : static_cast<SampleType>(0);
+        
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel) {
+            auto* data = block.getChannelPointer(channel);
+            
+            for (int sample = 0; sample < numSamples; ++sample)
+                data[sample] *= shaped[sample];
+        }
+    }
+    
+    //How ChannelPacker lays a block out for the SIMD loop
+    enum class ChannelPacking
+    {
+        //Time both layouts on the first calls and keep whichever is faster
+        automatic = 0,
+        
+        //One channel at a time, the registers run along each channel
+        planar,
+        
+        //Channels interleaved so each register holds the same sample index of several channels
+        packed
+    };
+    
+    //Process wide override for benchmarking and A/B comparisons, starts from VIATOR_CHANNEL_PACKING
+    //(planar, packed, anything else is automatic)
+    inline std::atomic<int>& getChannelPackingOverride()
+    {
+        static std::atomic<int> channelPacking { [] {
+            auto text = juce::SystemStats::getEnvironmentVariable("VIATOR_CHANNEL_PACKING", {}).trim().toLowerCase();
+            return static_cast<int>(text == "planar" ? ChannelPacking::planar
+                                  : text == "packed" ? ChannelPacking::packed : ChannelPacking::automatic);
+        }() };
+        
+        return channelPacking;
+    }
+    
+    inline void setChannelPacking(ChannelPacking newChannelPacking) noexcept
+    {
+        getChannelPackingOverride().store(static_cast<int>(newChannelPacking), std::memory_order_relaxed);
+    }
+    
+    inline ChannelPacking getChannelPacking() noexcept
+    {
+        return static_cast<ChannelPacking>(getChannelPackingOverride().load(std::memory_order_relaxed));
+    }
+    
+    //Runs a model over every channel of a block either planar or packed. Packing interleaves up to
+    //maxPackedChannels channels into a scratch buffer, padded to a power of two per sample index, so
+    //the whole block is one run of aligned registers with no scalar head or tail per channel and the
+    //gain ramp is worked out once per sample index. It costs a copy in and out, so whether it wins
+    //depends on the model, block length and CPU; in automatic mode each packer times both on its first
+    //calls and keeps the faster. Float only, double and mono always run planar.
+    //One per plugin instance, audio thread only once prepared
+    class ChannelPacker
+    {
+    public:
+        static constexpr int maxPackedChannels = 8;
+        
+        //Calls timed per layout before automatic mode settles
+        static constexpr int trialsPerLayout = 16;
+        
+        //Allocates, call from prepareToPlay. maxBlockSize is the most samples per channel of any call
+        void prepare(int numChannels, int maxBlockSize)
+        {
+           #if JUCE_USE_SIMD
+            capacity = juce::nextPowerOfTwo(juce::jlimit(1, maxPackedChannels, numChannels)) * juce::jmax(0, maxBlockSize);
+            storage.allocate(static_cast<size_t>(capacity + 2 * width), true);
+            packed = DistortionSIMD::Vec::getNextSIMDAlignedPtr(storage.get());
+           #else
+            juce::ignoreUnused(numChannels, maxBlockSize);
+           #endif
+            
+            resetTrials();
+        }
+        
+        //Same gain ramp as processChannel: gainStart + gainIncrement * (sample + 1)
+        template <typename Model, typename SampleType>
+        void process(const juce::dsp::AudioBlock<SampleType>& block, const Coefficients &coefficients, SampleType gainStart,
+                     SampleType gainIncrement, bool vectorised = DistortionSIMD::isAvailable()) noexcept
+        {
+           #if JUCE_USE_SIMD
+            if constexpr (std::is_same<SampleType, float>::value) {
+                auto numChannels = static_cast<int>(block.getNumChannels());
+                
+                if (vectorised && canPack(numChannels, static_cast<int>(block.getNumSamples()))) {
+                    auto layout = chooseLayout(numChannels);
+                    auto isTrial = getChannelPacking() == ChannelPacking::automatic && ! isSettled;
+                    auto startTicks = isTrial ? juce::Time::getHighResolutionTicks() : 0;
+                    
+                    if (layout == ChannelPacking::packed) {
+                        processPacked<Model>(block, coefficients, gainStart, gainIncrement);
+                    } else {
+                        processPlanar<Model>(block, coefficients, gainStart, gainIncrement, true);
+                    }
+                    
+                    if (isTrial) {
+                        addTrial(layout, juce::Time::getHighResolutionTicks() - startTicks, block.getNumSamples());
+                    }
+                    
+                    return;
+                }
+            }
+           #endif
+            
+            processPlanar<Model>(block, coefficients, gainStart, gainIncrement, vectorised);
+        }
+        
+        //What automatic mode has settled on, planar until it has
+        ChannelPacking getChosenLayout() const noexcept
+        {
+            return isSettled ? chosenLayout : ChannelPacking::planar;
+        }
+        
+    private:
+        
+        template <typename Model, typename SampleType>
+        static void processPlanar(const juce::dsp::AudioBlock<SampleType>& block, const Coefficients &coefficients, SampleType gainStart,
+                                  SampleType gainIncrement, bool vectorised) noexcept
+        {
+            for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+                processChannel<Model, SampleType>(block.getChannelPointer(channel), static_cast<int>(block.getNumSamples()),
+                                                  coefficients, gainStart, gainIncrement, vectorised);
+        }
+        
+        void resetTrials() noexcept
+        {
+            trialChannels = 0;
+            isSettled = false;
+            chosenLayout = ChannelPacking::planar;
+            
+            for (int layout = 0; layout < 2; ++layout) {
+                numTrials[layout] = 0;
+                bestTicksPerSample[layout] = std::numeric_limits<double>::max();
+            }
+        }
+        
+        ChannelPacking chooseLayout(int numChannels) noexcept
+        {
+            auto forced = getChannelPacking();
+            
+            if (forced != ChannelPacking::automatic)
+                return forced;
+            
+            //A different channel count is a different trade off, start again
+            if (numChannels != trialChannels) {
+                resetTrials();
+                trialChannels = numChannels;
+            }
+            
+            if (isSettled)
+                return chosenLayout;
+            
+            //Alternate, so both layouts see the same mix of block lengths
+            return numTrials[0] <= numTrials[1] ? ChannelPacking::planar : ChannelPacking::packed;
+        }
+        
+        //The best call of each layout rather than the mean, a preempted call says nothing about the layout
+        void addTrial(ChannelPacking layout, juce::int64 ticks, size_t numSamples) noexcept
+        {
+            auto index = layout == ChannelPacking::packed ? 1 : 0;
+            auto ticksPerSample = static_cast<double>(ticks) / static_cast<double>(juce::jmax<size_t>(1, numSamples));
+            
+            bestTicksPerSample[index] = juce::jmin(bestTicksPerSample[index], ticksPerSample);
+            ++numTrials[index];
+            
+            if (numTrials[0] >= trialsPerLayout && numTrials[1] >= trialsPerLayout) {
+                chosenLayout = bestTicksPerSample[1] < bestTicksPerSample[0] ? ChannelPacking::packed : ChannelPacking::planar;
+                isSettled = true;
+            }
+        }
+        
+        int trialChannels = 0;
+        int numTrials[2] = {};
+        double bestTicksPerSample[2] = {};
+        bool isSettled = false;
+        ChannelPacking chosenLayout = ChannelPacking::planar;
+        
+       #if JUCE_USE_SIMD
+        static constexpr int width = static_cast<int>(DistortionSIMD::Vec::SIMDNumElements);
+        
+        bool canPack(int numChannels, int numSamples) const noexcept
+        {
+            return numChannels > 1 && numChannels <= maxPackedChannels
+                && juce::nextPowerOfTwo(numChannels) * numSamples <= capacity;
+        }
+        
+        //Sample n of channel c lives at packed[n * stride + c], the padding lanes and the tail of the
+        //last register are zeroed so they stay finite whatever the model does to them
+        template <typename Model>
+        void processPacked(const juce::dsp::AudioBlock<float>& block, const Coefficients &coefficients, float gainStart, float gainIncrement) noexcept
+        {
+            using Vec = DistortionSIMD::Vec;
+            
+            auto numChannels = static_cast<int>(block.getNumChannels());
+            auto numSamples = static_cast<int>(block.getNumSamples());
+            auto stride = juce::nextPowerOfTwo(numChannels);
+            auto numValues = numSamples * stride;
+            auto paddedValues = (numValues + width - 1) / width * width;
+            
+            for (int channel = 0; channel < numChannels; ++channel) {
+                auto* source = block.getChannelPointer(static_cast<size_t>(channel));
+                
+                for (int sample = 0; sample < numSamples; ++sample)
+                    packed[sample * stride + channel] = source[sample];
+            }
+            
+            for (int channel = numChannels; channel < stride; ++channel) {
+                for (int sample = 0; sample < numSamples; ++sample)
+                    packed[sample * stride + channel] = 0.0f;
+            }
+            
+            std::fill(packed + numValues, packed + paddedValues, 0.0f);
+            
+            //Lane l of the register starting at value v is sample (v + l) / stride. With a stride at least
+            //as wide as a register that's the same sample for every lane
+            Vec laneRamp;
+            for (int lane = 0; lane < width; ++lane)
+                laneRamp.set(static_cast<size_t>(lane), gainIncrement * static_cast<float>(lane / stride + 1));
+            
+            for (int value = 0; value < paddedValues; value += width) {
+                auto gain = laneRamp + (gainStart + gainIncrement * static_cast<float>(value / stride));
+                auto output = Model::processRegister(Vec::fromRawArray(packed + value), coefficients) * gain;
+                output.copyToRawArray(packed + value);
+            }
+            
+            for (int channel = 0; channel < numChannels; ++channel) {
+                auto* destination = block.getChannelPointer(static_cast<size_t>(channel));
+                
+                for (int sample = 0; sample < numSamples; ++sample)
+                    destination[sample] = packed[sample * stride + channel];
+            }
+        }
+        
+        juce::HeapBlock<float> storage;
+        float* packed = nullptr;
+        int capacity = 0;
+       #endif
+    };
+    
+    //One model as a juce::dsp processor, so it can sit in a ProcessorChain
+    template <typename SampleType, typename Model>
+    class Shaper
+    {
+    public:
+        void setCoefficients(const Coefficients &newCoefficients) noexcept
+        {
+            coefficients = newCoefficients;
+        }
+
+        void prepare(const juce::dsp::ProcessSpec &spec)
+        {
+            channelPacker.prepare(static_cast<int>(spec.numChannels), static_cast<int>(spec.maximumBlockSize));
+        }
+
+        void reset() noexcept
+        {
+        }
+
+        template <typename ProcessContext>
+        void process(const ProcessContext &context) noexcept
+        {
+            auto&& outputBlock = context.getOutputBlock();
+
+            if (context.usesSeparateInputAndOutputBlocks())
+                outputBlock.copyFrom(context.getInputBlock());
+
+            if (context.isBypassed)
+                return;
+
+            channelPacker.process<Model, SampleType>(outputBlock, coefficients, static_cast<SampleType>(1), static_cast<SampleType>(0));
+        }
+
+    private:
+        Coefficients coefficients;
+        ChannelPacker channelPacker;
+    };
+    
+    //Below this distance (scaled by the signal level) consecutive inputs are treated as equal
+    //and the divided differences fall back to evaluating the curve at the midpoint
+    constexpr double illConditionedTolerance = 1.0e-5;
+    
+    inline bool isIllConditioned(double difference, double u) noexcept
+    {
+        return std::abs(difference) < illConditionedTolerance * (1.0 + std::abs(u));
+    }
+    
+    //(F2(a) - F2(b)) / (a - b), with F2(a) already known
+    template <typename Model>
+    double dividedDifference2(double a, double b, double antiderivative2a, double antiderivative2b, const Coefficients &coefficients) noexcept
+    {
+        if (isIllConditioned(a - b, a)) {
+            return Model::antiderivative1(0.5 * (a + b), coefficients);
+        }
+        
+        return (antiderivative2a - antiderivative2b) / (a - b);
+    }
+    
+    //Shapes one channel span with first or second order ADAA, same gain ramp as processChannel.
+    //The state carries the last inputs over from the previous span; the cached antiderivatives
+    //are refreshed here because the coefficients may have moved since then.
+    //Computed in double, the antiderivatives cancel heavily for close inputs.
+    template <typename Model, typename SampleType>
+    void processChannelAntiderivative(SampleType* data, int numSamples, const Coefficients &coefficients, SampleType gainStart, SampleType gainIncrement, int order, AntiderivativeState &state) noexcept
+    {
+        if (order == firstOrderAntialiasing) {
+            state.antiderivative1 = Model::antiderivative1(state.x1, coefficients);
+            
+            for (int sample = 0; sample < numSamples; ++sample) {
+                double u = static_cast<double>(data[sample]) * coefficients.inputGain;
+                double antiderivative1 = Model::antiderivative1(u, coefficients);
+                double difference = u - state.x1;
+                
+                double output = isIllConditioned(difference, u) ? Model::curve(0.5 * (u + state.x1), coefficients)
+                                                                : (antiderivative1 - state.antiderivative1) / difference;
+                
+                state.x2 = state.x1;
+                state.x1 = u;
+                state.antiderivative1 = antiderivative1;
+                
+                data[sample] = static_cast<SampleType>(output) * (gainStart + gainIncrement * static_cast<SampleType>(sample + 1));
+            }
+            
+            return;
+        }
+        
+        state.antiderivative2 = Model::antiderivative2(state.x1, coefficients);
+        state.lastDifference = dividedDifference2<Model>(state.x1, state.x2, state.antiderivative2, Model::antiderivative2(state.x2, coefficients), coefficients);
+        
+        for (int sample = 0; sample < numSamples; ++sample) {
+            double u = static_cast<double>(data[sample]) * coefficients.inputGain;
+            double antiderivative2 = Model::antiderivative2(u, coefficients);
+            double difference = dividedDifference2<Model>(u, state.x1, antiderivative2, state.antiderivative2, coefficients);
+            double outerDifference = u - state.x2;
+            double output;
+            
+            if (isIllConditioned(outerDifference, u)) {
+                //x[n] ~ x[n-2], expand around their mean instead (Bilbao et al.)
+                double mean = 0.5 * (u + state.x2);
+                double delta = mean - state.x1;
+                
+                if (isIllConditioned(delta, mean)) {
+                    output = Model::curve(0.5 * (mean + state.x1), coefficients);
+                } else {
+                    output = (2.0 / delta) * (Model::antiderivative1(mean, coefficients)
+                                              + (state.antiderivative2 - Model::antiderivative2(mean, coefficients)) / delta);
+                }
+            } else {
+                output = 2.0 * (difference - state.lastDifference) / outerDifference;
+            }
+            
+            state.x2 = state.x1;
+            state.x1 = u;
+            state.antiderivative2 = antiderivative2;
+            state.lastDifference = difference;
+            
+            data[sample] = static_cast<SampleType>(output) * (gainStart + gainIncrement * static_cast<SampleType>(sample + 1));
+        }
+    }
+}
+}
@@ -0,0 +1,213 @@
+/*
+  ==============================================================================
+
+    LookupTableShaper.h
+
+    Table driven waveshaper shared by the plugins in this repo. A curve is
+    sampled once into per-segment polynomials (linear or cubic) so the audio
+    thread only does a clamp, an index and a Horner step per sample, with no
+    branches and no transcendental calls.
+
+    Build the table from prepareToPlay (or any non-audio thread), it allocates.
+    Inputs outside [minInput, maxInput] are clamped, so pick a range that
+    covers the signal after any input gain.
+
+    Size and error go together: a table is numSegments * (1 + order) floats,
+    getMaxError measures what a given size gives for a curve and
+    findNumSegments picks the smallest power of two under an error target.
+    The default, 1024 cubic segments, is 16 KB and stays in L1.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace ViatorDSP
+{
+    template <typename FloatType>
+    class LookupTableShaper
+    {
+    public:
+        enum class Interpolation
+        {
+            linear,
+            cubic
+        };
+        
+        using Curve = std::function<double(double)>;
+        
+        static constexpr int defaultNumSegments = 1024;
+        
+        //Samples the curve over [minInput, maxInput], allocates so keep it off the audio thread
+        void build(const Curve& curve, FloatType newMinInput, FloatType newMaxInput,
+                   int newNumSegments = defaultNumSegments, Interpolation newInterpolation = Interpolation::cubic)
+        {
+            jassert(newMaxInput > newMinInput && newNumSegments > 0);
+            
+            minInput = newMinInput;
+            maxInput = newMaxInput;
+            numSegments = newNumSegments;
+            interpolation = newInterpolation;
+            stride = interpolation == Interpolation::cubic ? 4 : 2;
+            scale = static_cast<FloatType>(numSegments) / (maxInput - minInput);
+            
+            //Over-allocated so the table can start on a cache line
+            auto numValues = static_cast<size_t>(numSegments * stride);
+            storage.allocate(numValues + cacheLineFloats, true);
+            auto address = reinterpret_cast<uintptr_t>(storage.get());
+            coefficients = reinterpret_cast<FloatType*>((address + cacheLineBytes - 1) & ~static_cast<uintptr_t>(cacheLineBytes - 1));
+            
+            double width = static_cast<double>(maxInput - minInput) / numSegments;
+            
+            for (int segment = 0; segment < numSegments; ++segment) {
+                double start = static_cast<double>(minInput) + width * segment;
+                auto* c = coefficients + segment * stride;
+                
+                //The end points are nudged inside the segment, so a curve with a jump on a
+                //segment boundary (like the DC fold at |x| = 1) keeps both sides of it
+                if (interpolation == Interpolation::linear) {
+                    double y0 = curve(start + width * edgeNudge);
+                    double y1 = curve(start + width * (1.0 - edgeNudge));
+                    double slope = (y1 - y0) / (1.0 - 2.0 * edgeNudge);
+                    
+                    c[0] = static_cast<FloatType>(y0 - slope * edgeNudge);
+                    c[1] = static_cast<FloatType>(slope);
+                } else {
+                    fitCubic(curve, start, width, c);
+                }
+            }
+        }
+        
+        bool isBuilt() const noexcept
+        {
+            return coefficients != nullptr;
+        }
+        
+        FloatType processSample(FloatType input) const noexcept
+        {
+            return interpolation == Interpolation::cubic ? evaluate<4>(input) : evaluate<2>(input);
+        }
+        
+        //Shapes a span in place, the interpolation is picked once for the whole span
+        void process(FloatType* data, int numSamples) const noexcept
+        {
+            if (interpolation == Interpolation::cubic) {
+                for (int sample = 0; sample < numSamples; ++sample)
+                    data[sample] = evaluate<4>(data[sample]);
+            } else {
+                for (int sample = 0; sample < numSamples; ++sample)
+                    data[sample] = evaluate<2>(data[sample]);
+            }
+        }
+        
+        size_t getSizeInBytes() const noexcept
+        {
+            return static_cast<size_t>(numSegments * stride) * sizeof(FloatType);
+        }
+        
+        //Largest absolute difference to the curve over the table's range
+        double getMaxError(const Curve& curve, int numTestPoints = 1 << 16) const
+        {
+            double maxError = 0.0;
+            
+            for (int point = 0; point < numTestPoints; ++point) {
+                auto input = minInput + (maxInput - minInput) * static_cast<FloatType>(point) / static_cast<FloatType>(numTestPoints - 1);
+                maxError = juce::jmax(maxError, std::abs(static_cast<double>(processSample(input)) - curve(static_cast<double>(input))));
+            }
+            
+            return maxError;
+        }
+        
+        //Smallest power of two segment count that meets maxError, capped at maxNumSegments
+        static int findNumSegments(const Curve& curve, FloatType minInput, FloatType maxInput, Interpolation interpolation,
+                                   double maxError, int maxNumSegments = 1 << 16)
+        {
+            LookupTableShaper table;
+            int numSegments = 16;
+            
+            for (; numSegments < maxNumSegments; numSegments *= 2) {
+                table.build(curve, minInput, maxInput, numSegments, interpolation);
+                
+                if (table.getMaxError(curve) <= maxError)
+                    break;
+            }
+            
+            return juce::jmin(numSegments, maxNumSegments);
+        }
+        
+    private:
+        
+        template <int order>
+        FloatType evaluate(FloatType input) const noexcept
+        {
+            jassert(coefficients != nullptr);
+            
+            //min/max and int conversions only, NaN lands on segment 0 rather than outside the table
+            auto position = (juce::jlimit(minInput, maxInput, input) - minInput) * scale;
+            auto segment = juce::jmax(0, juce::jmin(static_cast<int>(position), numSegments - 1));
+            auto t = position - static_cast<FloatType>(segment);
+            auto* c = coefficients + segment * order;
+            
+            if constexpr (order == 4) {
+                return ((c[3] * t + c[2]) * t + c[1]) * t + c[0];
+            } else {
+                return c[1] * t + c[0];
+            }
+        }
+        
+        //Cubic through four points of the segment, solved in double and stored as c0 + c1 t + c2 t^2 + c3 t^3
+        static void fitCubic(const Curve& curve, double start, double width, FloatType* c)
+        {
+            const double nodes[4] = {edgeNudge, 1.0 / 3.0, 2.0 / 3.0, 1.0 - edgeNudge};
+            double matrix[4][5];
+            
+            for (int row = 0; row < 4; ++row) {
+                double power = 1.0;
+                
+                for (int column = 0; column < 4; ++column) {
+                    matrix[row][column] = power;
+                    power *= nodes[row];
+                }
+                
+                matrix[row][4] = curve(start + width * nodes[row]);
+            }
+            
+            //Gaussian elimination, the Vandermonde matrix of these nodes is well conditioned
+            for (int pivot = 0; pivot < 4; ++pivot) {
+                for (int row = pivot + 1; row < 4; ++row) {
+                    double factor = matrix[row][pivot] / matrix[pivot][pivot];
+                    
+                    for (int column = pivot; column < 5; ++column)
+                        matrix[row][column] -= factor * matrix[pivot][column];
+                }
+            }
+            
+            double solution[4];
+            
+            for (int row = 3; row >= 0; --row) {
+                double sum = matrix[row][4];
+                
+                for (int column = row + 1; column < 4; ++column)
+                    sum -= matrix[row][column] * solution[column];
+                
+                solution[row] = sum / matrix[row][row];
+            }
+            
+            for (int index = 0; index < 4; ++index)
+                c[index] = static_cast<FloatType>(solution[index]);
+        }
+        
+        static constexpr double edgeNudge = 1.0e-6;
+        static constexpr size_t cacheLineBytes = 64;
+        static constexpr size_t cacheLineFloats = cacheLineBytes / sizeof(FloatType);
+        
+        juce::HeapBlock<FloatType> storage;
+        FloatType* coefficients = nullptr;
+        FloatType minInput = -1, maxInput = 1, scale = 1;
+        int numSegments = 0;
+        int stride = 4;
+        Interpolation interpolation = Interpolation::cubic;
+    };
+}
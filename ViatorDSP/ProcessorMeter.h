@@ -0,0 +1,297 @@
+/*
+  ==============================================================================
+
+    ProcessorMeter.h
+
+    Per instance CPU instrumentation for processBlock. The audio thread puts
+    one record per block into a fixed ring of atomics (a timestamp pair, a
+    store and a couple of relaxed increments, no locks and no allocation),
+    anything else reads the ring back and works out the statistics over the
+    most recent blocks.
+
+    Each block is timed against its real time budget, numSamples / sampleRate.
+    Blocks over xrunRiskThreshold of the budget are counted as xrun risks, one
+    plugin using that much of the callback leaves the rest of the session
+    little room. A block is counted as a denormal event when the floating
+    point status flags say something underflowed or read a denormal while it
+    ran, i.e. work that would have gone subnormal without flush-to-zero.
+
+    Put a ScopedBlock after the ScopedNoDenormals in processBlock, that one
+    restores the status flags it saved and would hide the ones raised since.
+
+    ProcessorMeterLogger appends the statistics to a CSV file once a second
+    from its own thread, see createFromEnvironment.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if JUCE_INTEL
+ #include <xmmintrin.h>
+#endif
+
+namespace ViatorDSP
+{
+    class ProcessorMeter
+    {
+    public:
+        //Blocks the statistics cover, a little over ten seconds of 512 sample blocks at 48 kHz
+        static constexpr int ringSize = 1024;
+        static constexpr double xrunRiskThreshold = 0.5;
+
+        struct Statistics
+        {
+            int numBlocks = 0;
+
+            //Block times in microseconds
+            double minMicroseconds = 0.0;
+            double meanMicroseconds = 0.0;
+            double p99Microseconds = 0.0;
+            double maxMicroseconds = 0.0;
+
+            //Share of the real time budget, overall and for the worst 1% of blocks
+            double meanBudgetPercent = 0.0;
+            double p99BudgetPercent = 0.0;
+
+            //Since the instance was created
+            juce::uint64 totalBlocks = 0;
+            juce::uint64 xrunRisks = 0;
+            juce::uint64 denormalEvents = 0;
+        };
+
+        //Times one block and records it when it goes out of scope
+        class ScopedBlock
+        {
+        public:
+            ScopedBlock(ProcessorMeter& meterToUse, int numSamplesToUse) noexcept
+            : meter(meterToUse), numSamples(numSamplesToUse), startTicks(juce::Time::getHighResolutionTicks())
+            {
+                clearStatusFlags();
+            }
+
+            ~ScopedBlock()
+            {
+                meter.addBlock(juce::Time::getHighResolutionTicks() - startTicks, numSamples, hasDenormalFlags());
+            }
+
+        private:
+            ProcessorMeter& meter;
+            int numSamples;
+            juce::int64 startTicks;
+
+            JUCE_DECLARE_NON_COPYABLE (ScopedBlock)
+        };
+
+        ProcessorMeter()
+        {
+            for (auto& record : records)
+                record.store(0, std::memory_order_relaxed);
+        }
+
+        //Any thread, the budget only needs the rate
+        void prepare(double newSampleRate) noexcept
+        {
+            sampleRate.store(newSampleRate, std::memory_order_relaxed);
+        }
+
+        //Audio thread only, a single writer
+        void addBlock(juce::int64 elapsedTicks, int numSamples, bool sawDenormals) noexcept
+        {
+            auto nanoseconds = static_cast<juce::uint64>(1.0e9 * static_cast<double>(juce::jmax<juce::int64>(0, elapsedTicks))
+                                                         / static_cast<double>(ticksPerSecond));
+            auto rate = sampleRate.load(std::memory_order_relaxed);
+
+            if (rate > 0.0 && numSamples > 0 && static_cast<double>(nanoseconds) > xrunRiskThreshold * 1.0e9 * numSamples / rate)
+                xrunRisks.fetch_add(1, std::memory_order_relaxed);
+
+            if (sawDenormals)
+                denormalEvents.fetch_add(1, std::memory_order_relaxed);
+
+            auto index = writeIndex.load(std::memory_order_relaxed);
+            records[index % ringSize].store(pack(nanoseconds, numSamples), std::memory_order_relaxed);
+            writeIndex.store(index + 1, std::memory_order_release);
+        }
+
+        //Any thread but the audio one, allocates
+        Statistics getStatistics() const
+        {
+            Statistics statistics;
+            statistics.xrunRisks = xrunRisks.load(std::memory_order_relaxed);
+            statistics.denormalEvents = denormalEvents.load(std::memory_order_relaxed);
+
+            auto end = writeIndex.load(std::memory_order_acquire);
+            auto start = end > static_cast<juce::uint64>(ringSize) ? end - ringSize : 0;
+
+            std::vector<juce::uint64> copied;
+            copied.reserve(static_cast<size_t>(end - start));
+
+            //A record is one atomic so it's never torn, if the audio thread laps this copy
+            //a few of them are just newer blocks than the index says
+            for (auto index = start; index < end; ++index)
+                copied.push_back(records[index % ringSize].load(std::memory_order_relaxed));
+
+            statistics.totalBlocks = end;
+            statistics.numBlocks = static_cast<int>(copied.size());
+
+            if (copied.empty())
+                return statistics;
+
+            auto rate = sampleRate.load(std::memory_order_relaxed);
+            std::vector<double> times, loads;
+            times.reserve(copied.size());
+            loads.reserve(copied.size());
+
+            double totalTime = 0.0;
+            double totalBudget = 0.0;
+
+            for (auto record : copied) {
+                auto microseconds = static_cast<double>(record >> sampleBits) * 1.0e-3;
+                auto budget = rate > 0.0 ? 1.0e6 * static_cast<double>(record & sampleMask) / rate : 0.0;
+
+                times.push_back(microseconds);
+                loads.push_back(budget > 0.0 ? 100.0 * microseconds / budget : 0.0);
+                totalTime += microseconds;
+                totalBudget += budget;
+            }
+
+            statistics.minMicroseconds = *std::min_element(times.begin(), times.end());
+            statistics.maxMicroseconds = *std::max_element(times.begin(), times.end());
+            statistics.meanMicroseconds = totalTime / static_cast<double>(times.size());
+            statistics.p99Microseconds = getPercentile(times, 0.99);
+            statistics.meanBudgetPercent = totalBudget > 0.0 ? 100.0 * totalTime / totalBudget : 0.0;
+            statistics.p99BudgetPercent = getPercentile(loads, 0.99);
+
+            return statistics;
+        }
+
+    private:
+
+        //Nanoseconds above, the block's sample count below
+        static constexpr int sampleBits = 24;
+        static constexpr juce::uint64 sampleMask = (1ull << sampleBits) - 1;
+
+        static juce::uint64 pack(juce::uint64 nanoseconds, int numSamples) noexcept
+        {
+            auto samples = static_cast<juce::uint64>(juce::jlimit(0, static_cast<int>(sampleMask), numSamples));
+            return (juce::jmin(nanoseconds, (1ull << (64 - sampleBits)) - 1) << sampleBits) | samples;
+        }
+
+        static double getPercentile(std::vector<double>& values, double fraction)
+        {
+            auto rank = static_cast<size_t>(fraction * static_cast<double>(values.size() - 1) + 0.5);
+            std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(rank), values.end());
+            return values[rank];
+        }
+
+        //The sticky underflow and denormal operand flags, where the platform has them
+        static void clearStatusFlags() noexcept
+        {
+           #if JUCE_INTEL
+            _mm_setcsr(_mm_getcsr() & ~0x3fu);
+           #elif JUCE_ARM && JUCE_64BIT && (JUCE_GCC || JUCE_CLANG)
+            juce::uint64 status;
+            asm volatile("mrs %0, fpsr" : "=r"(status));
+            asm volatile("msr fpsr, %0" : : "r"(status & ~static_cast<juce::uint64>(0x9f)));
+           #endif
+        }
+
+        static bool hasDenormalFlags() noexcept
+        {
+           #if JUCE_INTEL
+            //UE | DE
+            return (_mm_getcsr() & 0x12u) != 0;
+           #elif JUCE_ARM && JUCE_64BIT && (JUCE_GCC || JUCE_CLANG)
+            //IDC | UFC
+            juce::uint64 status;
+            asm volatile("mrs %0, fpsr" : "=r"(status));
+            return (status & 0x88) != 0;
+           #else
+            return false;
+           #endif
+        }
+
+        const juce::int64 ticksPerSecond = juce::Time::getHighResolutionTicksPerSecond();
+        std::atomic<double> sampleRate { 0.0 };
+
+        std::atomic<juce::uint64> records[ringSize];
+        std::atomic<juce::uint64> writeIndex { 0 };
+
+        std::atomic<juce::uint64> xrunRisks { 0 };
+        std::atomic<juce::uint64> denormalEvents { 0 };
+
+        JUCE_DECLARE_NON_COPYABLE (ProcessorMeter)
+    };
+
+    //Appends a meter's statistics to a CSV file once a second on its own thread
+    class ProcessorMeterLogger : private juce::Thread
+    {
+    public:
+        ProcessorMeterLogger(const ProcessorMeter& meterToLog, const juce::File& fileToWrite, int intervalMilliseconds = 1000)
+        : juce::Thread("Meter Logger"), meter(meterToLog), file(fileToWrite), interval(intervalMilliseconds)
+        {
+            if (! file.exists())
+                file.appendText("time,blocks,min_us,mean_us,p99_us,max_us,mean_budget_percent,p99_budget_percent,xrun_risks,denormal_events\n");
+
+            startThread(2);
+        }
+
+        ~ProcessorMeterLogger() override
+        {
+            stopThread(2000);
+        }
+
+        //When VIATOR_METER_LOG names a directory, a logger writing <name>-<time>.csv there, otherwise null
+        static std::unique_ptr<ProcessorMeterLogger> createFromEnvironment(const ProcessorMeter& meter, const juce::String& name)
+        {
+            auto directory = juce::SystemStats::getEnvironmentVariable("VIATOR_METER_LOG", {});
+
+            if (directory.isEmpty() || ! juce::File::isAbsolutePath(directory))
+                return nullptr;
+
+            juce::File logDirectory(directory);
+
+            if (! logDirectory.createDirectory())
+                return nullptr;
+
+            auto fileName = juce::File::createLegalFileName(name) + "-" + juce::Time::getCurrentTime().formatted("%Y%m%d-%H%M%S") + ".csv";
+            return std::make_unique<ProcessorMeterLogger>(meter, logDirectory.getNonexistentChildFile(fileName, {}, false));
+        }
+
+    private:
+
+        void run() override
+        {
+            while (! threadShouldExit()) {
+                wait(interval);
+
+                auto statistics = meter.getStatistics();
+
+                if (statistics.numBlocks == 0)
+                    continue;
+
+                juce::String line;
+                line << juce::Time::getCurrentTime().toISO8601(true) << ","
+                     << statistics.numBlocks << ","
+                     << statistics.minMicroseconds << ","
+                     << statistics.meanMicroseconds << ","
+                     << statistics.p99Microseconds << ","
+                     << statistics.maxMicroseconds << ","
+                     << statistics.meanBudgetPercent << ","
+                     << statistics.p99BudgetPercent << ","
+                     << static_cast<juce::int64>(statistics.xrunRisks) << ","
+                     << static_cast<juce::int64>(statistics.denormalEvents) << "\n";
+
+                file.appendText(line);
+            }
+        }
+
+        const ProcessorMeter& meter;
+        juce::File file;
+        int interval;
+
+        JUCE_DECLARE_NON_COPYABLE (ProcessorMeterLogger)
+    };
+}
@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    SilenceDetector.h
+
+    Lets a processor skip blocks that have nothing in them. Below -150 dBFS
+    counts as silence, far under any converter's noise floor. The check is a
+    peak scan per channel through FloatVectorOperations::findMinAndMax (SIMD
+    on every platform JUCE vectorises), stopping at the first channel with
+    anything in it, or free when the host hands over a buffer already
+    flagged as cleared.
+
+    Silent input isn't enough to skip on its own: a filter, an oversampler or
+    a convolver still has a tail to play out, and a curve with an offset at
+    zero doesn't put out silence at all. So a processor runs its silent blocks
+    in full until the input has been silent for at least its latency plus its
+    tail (setMinimumSilence, anything still in the pipeline has come out by
+    then) and a block has come out silent as well, and only then skips the
+    rest until something comes in. Skipped blocks are cleared with
+    AudioBuffer::clear, so the buffer carries JUCE's cleared flag (what JUCE
+    has in place of VST3's silence flags) on to whatever reads it next.
+
+    beginBlock before processing says whether to skip, endBlock after a block
+    processed in full looks at what came out. A setting that can change what
+    comes out for silence (a model, a bias) calls settingsChanged, which makes
+    the processor run in full again until it has settled on the new one.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace ViatorDSP
+{
+    class SilenceDetector
+    {
+    public:
+        //-150 dBFS
+        static constexpr float threshold = 3.1622777e-8f;
+
+        //True when the first numChannels channels all peak below the threshold
+        template <typename SampleType>
+        static bool isSilent(const juce::AudioBuffer<SampleType>& buffer, int numChannels) noexcept
+        {
+            if (buffer.hasBeenCleared())
+                return true;
+
+            auto numSamples = buffer.getNumSamples();
+
+            for (int channel = 0; channel < juce::jmin(numChannels, buffer.getNumChannels()); ++channel) {
+                auto range = juce::FloatVectorOperations::findMinAndMax(buffer.getReadPointer(channel), numSamples);
+
+                if (juce::jmax(-range.getStart(), range.getEnd()) >= static_cast<SampleType>(threshold))
+                    return false;
+            }
+
+            return true;
+        }
+
+        //Samples of silent input before anything can be skipped, the processor's latency plus the
+        //longest tail it can ring on for. Audio thread, may change from block to block
+        void setMinimumSilence(int numSamples) noexcept
+        {
+            minimumSilence = juce::jmax(0, numSamples);
+        }
+
+        //With the block's input. True when the block can be skipped: it's silent, the input has
+        //been silent for longer than the minimum, and the last silent block processed came out silent
+        template <typename SampleType>
+        bool beginBlock(const juce::AudioBuffer<SampleType>& buffer, int numChannels) noexcept
+        {
+            isInputSilent = isSilent(buffer, numChannels);
+
+            if (isInputSilent) {
+                silentSamples = juce::jmin(silentSamples + static_cast<juce::int64>(buffer.getNumSamples()), maxSilentSamples);
+            } else {
+                silentSamples = 0;
+                hasSettled = false;
+            }
+
+            auto wasSkipping = isSkipping;
+            isSkipping = isInputSilent && hasSettled;
+            startedSkipping = isSkipping && ! wasSkipping;
+
+            return isSkipping;
+        }
+
+        //With the block's output, after a block that wasn't skipped. Sound still inside the latency
+        //comes out silent too, so this only counts once the input has been silent long enough
+        template <typename SampleType>
+        void endBlock(const juce::AudioBuffer<SampleType>& buffer, int numChannels) noexcept
+        {
+            hasSettled = isInputSilent && silentSamples >= minimumSilence && isSilent(buffer, numChannels);
+        }
+
+        //Something that changes the output for silent input, an offset has to come through
+        //the latency before the output can be judged again. Audio thread, before beginBlock
+        void settingsChanged() noexcept
+        {
+            silentSamples = 0;
+            hasSettled = false;
+        }
+
+        //The first skipped block after some that weren't, when state left over from
+        //the tail can be cleared so the next sound starts from nothing
+        bool hasStartedSkipping() const noexcept
+        {
+            return startedSkipping;
+        }
+
+        //prepareToPlay, anything left from before has to be processed in full again
+        void reset() noexcept
+        {
+            isInputSilent = hasSettled = isSkipping = startedSkipping = false;
+            silentSamples = 0;
+        }
+
+    private:
+        bool isInputSilent = false;
+        bool hasSettled = false;
+        bool isSkipping = false;
+        bool startedSkipping = false;
+        int minimumSilence = 0;
+
+        //Consecutive silent input samples, capped well before it could overflow
+        static constexpr juce::int64 maxSilentSamples = 1ll << 40;
+        juce::int64 silentSamples = 0;
+    };
+}
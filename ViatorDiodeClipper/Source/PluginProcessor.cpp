@@ -23,6 +23,7 @@ ViatorDiodeClipperAudioProcessor::ViatorDiodeClipperAudioProcessor()
 treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 ViatorDiodeClipperAudioProcessor::~ViatorDiodeClipperAudioProcessor()
@@ -113,13 +114,20 @@ void ViatorDiodeClipperAudioProcessor::changeProgramName (int index, const juce:
 //==============================================================================
 void ViatorDiodeClipperAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    meter.prepare(sampleRate);
+    
     juce::dsp::ProcessSpec spec;
     spec.maximumBlockSize = samplesPerBlock;
     spec.sampleRate = sampleRate;
     spec.numChannels = getTotalNumOutputChannels();
     
     inputGainProcessor.prepare(spec);
-    outputGainProcessor.prepare(spec);
+    
+    //Built on first use, make sure that isn't the audio thread
+    ViatorDSP::DistortionEngine::Diode::getTable();
+    
+    channelPacker.prepare(getTotalNumInputChannels(), samplesPerBlock);
+    silenceDetector.reset();
 }
 
 void ViatorDiodeClipperAudioProcessor::releaseResources()
@@ -153,8 +161,25 @@ bool ViatorDiodeClipperAudioProcessor::isBusesLayoutSupported (const BusesLayout
 #endif
 
 void ViatorDiodeClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+void ViatorDiodeClipperAudioProcessor::processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    process(buffer);
+}
+
+bool ViatorDiodeClipperAudioProcessor::supportsDoublePrecisionProcessing() const
+{
+    return true;
+}
+
+template <typename SampleType>
+void ViatorDiodeClipperAudioProcessor::process(juce::AudioBuffer<SampleType>& buffer)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     auto totalNumInputChannels  = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -162,32 +187,32 @@ void ViatorDiodeClipperAudioProcessor::processBlock (juce::AudioBuffer<float>& b
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
     
+    //Silent in, and silent out last time, so there's nothing to shape
+    if (silenceDetector.beginBlock(buffer, totalNumInputChannels)) {
+        buffer.clear();
+        return;
+    }
+    
     auto* rawInput = treeState.getRawParameterValue(inputSliderId);
     auto* rawDrive = treeState.getRawParameterValue(driveSliderId);
     auto* rawTrim = treeState.getRawParameterValue(trimSliderId);
     
-    juce::dsp::AudioBlock<float> audioBlock (buffer);
+    juce::dsp::AudioBlock<SampleType> audioBlock (buffer);
     
 //    inputGainProcessor.setGainDecibels(*rawInput);
 //    inputGainProcessor.process(juce::dsp::ProcessContextReplacing<float>(audioBlock));
 
-    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-    {
-        auto* outputData = buffer.getWritePointer (channel);
-        auto* inputData = buffer.getReadPointer(channel);
-
-        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-            outputData[sample] = (exp((((pow(10, (*rawInput * .05)) * .1) * inputData[sample]) / (scaleRange(*rawDrive, 0.0f, 24.0f, 2.0f, 1.0f) * scaleRange(*rawDrive, 0.0f, 24.0, 0.04f, 0.01)))) - 1);
-        }
-    }
+    //Input gain over n * Vt, the knobs only move per block
+    ViatorDSP::DistortionEngine::Coefficients coefficients;
+    coefficients.inputGain = (pow(10, (*rawInput * .05)) * .1) / (ViatorDSP::scaleRange(*rawDrive, 0.0f, 24.0f, 2.0f, 1.0f) * ViatorDSP::scaleRange(*rawDrive, 0.0f, 24.0, 0.04f, 0.01));
     
-    outputGainProcessor.setGainDecibels(*rawTrim - ((*rawInput + *rawDrive)));
-    outputGainProcessor.process(juce::dsp::ProcessContextReplacing<float>(audioBlock));
-}
-
-float ViatorDiodeClipperAudioProcessor::scaleRange(float input, float inputLow, float inputHigh, float outputLow, float outputHigh){
-    return ((input - inputLow) / (inputHigh - inputLow)) * (outputHigh - outputLow) + outputLow;
-
+    //The output gain goes on in the same pass as the curve
+    auto outputGain = static_cast<SampleType>(juce::Decibels::decibelsToGain(*rawTrim - ((*rawInput + *rawDrive))));
+    
+    auto inputChannels = audioBlock.getSubsetChannelBlock(0, static_cast<size_t>(totalNumInputChannels));
+    channelPacker.process<ViatorDSP::DistortionEngine::Diode>(inputChannels, coefficients, outputGain, static_cast<SampleType>(0));
+    
+    silenceDetector.endBlock(buffer, totalNumInputChannels);
 }
 
 //==============================================================================
@@ -0,0 +1,131 @@
+# viator_add_processor(<project> PRODUCT_NAME <name> PLUGIN_CODE <code>
+#                      [SOURCES files...] [BINARY_DATA files...])
+#
+# For one project folder this builds:
+#   <project>_DSP  a static library holding the processor and editor sources together
+#                  with the JUCE modules they use. Headless tools (benchmarks,
+#                  renderers) link it directly, no plugin wrapper involved.
+#   <project>      the plugin itself via juce_add_plugin, in VIATOR_PLUGIN_FORMATS,
+#                  when VIATOR_BUILD_PLUGINS is on.
+#
+# The JucePlugin_* settings the processors read are normally generated by the
+# Projucer, here they come from the arguments. PRODUCT_NAME and PLUGIN_CODE must
+# match the .jucer so hosts see the same plugin on every platform. SOURCES are
+# any translation units besides PluginProcessor.cpp and PluginEditor.cpp, relative
+# to the project's Source folder.
+
+set(VIATOR_CMAKE_DIR "${CMAKE_CURRENT_LIST_DIR}")
+
+function(viator_add_processor name)
+    cmake_parse_arguments(VIATOR "" "PRODUCT_NAME;PLUGIN_CODE" "SOURCES;BINARY_DATA" ${ARGN})
+
+    set(target ${name}_DSP)
+    set(source_dir "${CMAKE_CURRENT_SOURCE_DIR}/${name}/Source")
+    set(header_dir "${CMAKE_CURRENT_BINARY_DIR}/${name}/JuceLibraryCode")
+    set(sources ${source_dir}/PluginProcessor.cpp ${source_dir}/PluginEditor.cpp)
+    list(TRANSFORM VIATOR_SOURCES PREPEND "${source_dir}/")
+    list(APPEND sources ${VIATOR_SOURCES})
+
+    set(VIATOR_PROJECT_NAME ${name})
+    set(VIATOR_BINARY_DATA_INCLUDE "")
+
+    if(VIATOR_BINARY_DATA)
+        juce_add_binary_data(${name}_BinaryData SOURCES ${VIATOR_BINARY_DATA})
+        set_target_properties(${name}_BinaryData PROPERTIES POSITION_INDEPENDENT_CODE TRUE)
+        set(VIATOR_BINARY_DATA_INCLUDE "#include \"BinaryData.h\"")
+    endif()
+
+    # Shared by both targets, stands in for the Projucer's JuceLibraryCode/JuceHeader.h
+    configure_file("${VIATOR_CMAKE_DIR}/JuceHeader.h.in" "${header_dir}/JuceHeader.h" @ONLY)
+
+    set(module_settings
+        JUCE_WEB_BROWSER=0
+        JUCE_USE_CURL=0
+        JUCE_VST3_CAN_REPLACE_VST2=0
+        JUCE_STRICT_REFCOUNTEDPOINTER=1)
+
+    #==========================================================================
+    # Headless library
+
+    add_library(${target} STATIC ${sources})
+
+    target_include_directories(${target} PUBLIC ${source_dir} ${header_dir})
+
+    target_link_libraries(${target}
+        PRIVATE
+            juce::juce_audio_utils
+            juce::juce_dsp
+        PUBLIC
+            juce::juce_recommended_config_flags
+            juce::juce_recommended_warning_flags)
+
+    if(VIATOR_BINARY_DATA)
+        target_link_libraries(${target} PUBLIC ${name}_BinaryData)
+    endif()
+
+    target_compile_definitions(${target}
+        PUBLIC
+            JucePlugin_Name="${VIATOR_PRODUCT_NAME}"
+            JucePlugin_IsSynth=0
+            JucePlugin_WantsMidiInput=0
+            JucePlugin_ProducesMidiOutput=0
+            JucePlugin_IsMidiEffect=0
+            ${module_settings}
+        INTERFACE
+            $<TARGET_PROPERTY:${target},COMPILE_DEFINITIONS>)
+
+    # Consumers see the JUCE headers and module settings without compiling the modules again
+    target_include_directories(${target}
+        INTERFACE
+            $<TARGET_PROPERTY:${target},INCLUDE_DIRECTORIES>)
+
+    set_target_properties(${target} PROPERTIES
+        POSITION_INDEPENDENT_CODE TRUE
+        VISIBILITY_INLINES_HIDDEN TRUE
+        C_VISIBILITY_PRESET hidden
+        CXX_VISIBILITY_PRESET hidden)
+
+    set_property(GLOBAL APPEND PROPERTY VIATOR_PROCESSORS ${name})
+
+    #==========================================================================
+    # Plugin
+
+    if(NOT VIATOR_BUILD_PLUGINS)
+        return()
+    endif()
+
+    set(lv2_arguments "")
+
+    if(LV2 IN_LIST VIATOR_PLUGIN_FORMATS)
+        set(lv2_arguments LV2URI "https://github.com/landonviator/Distortion_Study/${name}")
+    endif()
+
+    juce_add_plugin(${name}
+        PRODUCT_NAME "${VIATOR_PRODUCT_NAME}"
+        COMPANY_NAME "Viator DSP"
+        PLUGIN_MANUFACTURER_CODE Manu
+        PLUGIN_CODE ${VIATOR_PLUGIN_CODE}
+        IS_SYNTH FALSE
+        NEEDS_MIDI_INPUT FALSE
+        NEEDS_MIDI_OUTPUT FALSE
+        IS_MIDI_EFFECT FALSE
+        VST3_CATEGORIES Fx Distortion
+        FORMATS ${VIATOR_PLUGIN_FORMATS}
+        ${lv2_arguments})
+
+    target_sources(${name} PRIVATE ${sources})
+    target_include_directories(${name} PRIVATE ${source_dir} ${header_dir})
+    target_compile_definitions(${name} PUBLIC ${module_settings})
+
+    target_link_libraries(${name}
+        PRIVATE
+            juce::juce_audio_utils
+            juce::juce_dsp
+        PUBLIC
+            juce::juce_recommended_config_flags
+            juce::juce_recommended_warning_flags)
+
+    if(VIATOR_BINARY_DATA)
+        target_link_libraries(${name} PRIVATE ${name}_BinaryData)
+    endif()
+endfunction()
@@ -289,8 +289,299 @@ static const unsigned char temp_binary_data_0[] =
 
 const char* pedalOverdrive_wav = (const char*) temp_binary_data_0;
 
-//================== pedal_background.png ==================
+//================== pedalAt12.wav ==================
 static const unsigned char temp_binary_data_1[] =
+{ 82,73,70,70,90,84,0,0,87,65,86,69,74,85,78,75,28,0,0,0,90,84,0,0,0,0,0,0,44,80,0,0,0,0,0,0,11,20,0,0,0,0,0,0,0,0,0,0,102,109,116,32,16,0,0,0,3,0,1,0,68,172,0,0,16,177,2,0,4,0,32,0,100,97,116,97,44,80,0,0,0,0,165,183,0,0,36,55,0,0,38,183,0,176,138,185,
+0,0,98,184,0,96,36,185,0,0,168,182,0,160,210,185,0,224,51,185,0,0,195,56,0,192,123,185,0,176,138,185,0,0,120,183,0,0,16,184,0,0,98,185,0,0,168,182,0,128,36,184,0,112,128,185,0,0,26,57,0,0,185,184,0,0,164,55,0,160,123,57,0,128,36,184,0,64,67,185,0,160,
+5,185,0,192,225,56,0,96,146,57,0,64,67,185,0,0,164,54,0,96,72,185,0,128,236,184,0,192,184,56,0,0,206,183,0,64,195,184,0,128,77,184,0,192,92,57,0,0,77,56,0,128,41,185,0,0,164,54,0,160,5,185,0,224,51,185,0,128,56,56,0,192,133,184,0,64,154,184,0,176,138,
+185,0,0,164,55,0,128,77,184,0,0,247,183,0,192,143,56,0,32,172,185,0,0,144,184,0,0,195,56,0,0,119,184,0,128,164,184,0,128,36,184,0,0,119,184,0,112,128,185,0,96,72,185,0,0,16,184,0,224,143,185,0,224,92,185,0,0,0,0,0,64,31,185,0,192,46,185,0,0,164,54,0,
+128,113,185,0,128,174,56,0,64,31,185,0,192,10,185,0,32,26,185,0,224,20,57,0,128,133,56,0,192,87,185,0,64,31,185,0,128,133,56,0,16,190,185,0,192,87,185,0,0,118,55,0,224,51,185,0,176,156,185,0,0,0,0,0,0,21,185,0,32,136,185,0,0,168,182,0,0,119,184,0,64,
+177,185,0,64,103,185,0,0,246,55,0,144,133,185,0,0,120,183,0,96,72,185,0,0,120,183,0,16,190,185,0,64,154,184,0,0,21,185,0,224,92,185,0,128,205,184,0,96,36,185,0,128,118,56,0,192,215,184,0,0,21,185,0,192,174,184,0,144,151,185,0,192,225,56,0,0,164,54,0,
+0,165,183,0,192,215,184,0,192,10,185,0,0,98,185,0,224,20,57,0,192,10,185,0,128,205,185,0,0,57,185,0,192,87,185,0,96,72,185,0,96,164,185,0,0,57,185,0,96,72,185,0,224,92,185,0,128,41,185,0,64,103,185,0,160,192,185,0,224,51,185,0,128,56,56,0,0,3,186,0,192,
+215,184,0,160,82,185,0,144,151,185,0,32,172,185,0,0,165,183,0,64,141,185,0,208,179,185,0,64,141,185,0,224,92,185,0,48,195,185,0,128,164,184,0,0,246,55,0,176,156,185,0,64,141,185,0,96,36,185,0,0,131,185,0,0,57,185,0,128,0,185,0,64,141,185,0,0,57,185,0,
+128,97,56,0,160,82,185,0,128,77,185,0,0,0,0,0,128,97,56,0,160,5,185,0,192,10,185,0,128,205,184,0,0,21,185,0,0,149,185,0,96,108,185,0,128,169,185,0,192,10,185,0,144,151,185,0,0,185,184,0,112,146,185,0,0,98,185,0,0,120,183,0,128,0,185,0,64,103,185,0,0,
+205,55,0,128,41,185,0,224,51,185,0,128,56,56,0,96,0,57,0,192,123,185,0,128,77,184,0,64,31,185,0,72,4,186,0,96,182,185,0,32,62,185,0,64,31,185,0,0,131,185,0,32,136,185,0,64,177,185,0,112,0,186,0,128,77,184,0,0,0,0,0,0,0,0,0,128,41,185,0,192,92,57,0,64,
+31,185,0,96,72,185,0,128,97,56,0,192,133,184,0,192,10,185,0,144,151,185,0,64,141,185,0,192,10,185,0,64,159,185,0,128,169,185,0,208,179,185,0,64,141,185,0,64,154,184,0,48,195,185,0,128,205,185,0,192,10,185,0,160,192,185,0,32,62,185,0,128,236,184,0,80,
+236,185,0,160,118,185,0,96,108,185,0,0,57,185,0,0,57,185,0,96,108,185,0,96,182,185,0,192,197,185,0,224,220,185,0,208,161,185,0,0,206,183,0,0,16,184,0,192,246,184,0,192,123,185,0,0,144,184,0,128,205,184,0,128,0,185,0,192,246,184,0,0,21,185,0,96,36,185,
+0,64,159,185,0,64,159,185,0,0,206,183,0,64,22,186,0,96,164,185,0,0,57,185,0,192,197,185,0,0,21,185,0,128,36,184,0,128,205,184,0,224,15,185,0,128,41,185,0,128,15,56,0,128,77,185,0,192,215,184,0,128,0,185,0,224,92,185,0,128,164,184,0,0,119,184,0,0,165,
+183,0,240,166,185,0,0,205,55,0,176,174,185,0,192,215,185,0,128,41,185,0,224,51,185,0,112,146,185,0,0,57,185,0,0,57,184,0,96,108,185,0,192,246,184,0,0,185,184,0,64,236,56,0,192,87,185,0,0,185,184,0,0,57,184,0,0,247,183,0,128,205,184,0,0,247,183,0,0,149,
+185,0,128,164,184,0,0,205,55,0,144,151,185,0,0,119,184,0,0,247,183,0,0,185,184,0,224,184,57,0,32,249,185,0,128,246,57,0,248,139,186,0,226,13,59,0,192,133,184,0,168,80,59,0,192,43,187,0,146,167,59,0,242,209,187,0,125,13,60,128,8,84,188,0,8,238,59,96,153,
+92,189,152,212,37,62,128,253,51,61,192,188,3,61,96,120,1,62,64,102,252,60,192,10,43,63,254,255,127,63,246,5,2,63,210,16,26,63,208,136,78,62,224,248,137,62,0,184,150,187,0,122,188,60,112,12,173,189,48,195,243,189,40,83,1,190,224,73,89,190,96,158,24,190,
+252,250,138,190,216,115,38,190,108,97,156,190,64,159,44,190,104,44,165,190,40,222,44,190,176,202,167,190,248,182,40,190,248,159,165,190,232,116,33,190,100,190,159,190,104,105,22,190,136,200,147,190,24,52,7,190,204,81,136,190,144,86,242,189,8,192,119,
+190,16,31,218,189,224,209,92,190,128,54,190,189,248,172,64,190,160,205,158,189,160,7,36,190,192,40,124,189,88,193,7,190,160,13,59,189,112,52,219,189,192,191,248,188,48,234,171,189,64,101,137,188,224,87,130,189,0,244,148,187,160,143,61,189,0,143,189,59,
+192,237,0,189,0,26,119,60,64,55,156,188,192,137,182,60,128,63,13,188,192,33,231,60,0,192,92,57,96,177,8,61,0,214,238,59,96,233,20,61,128,104,89,60,224,83,32,61,192,219,144,60,64,85,40,61,0,19,175,60,224,26,44,61,128,204,201,60,224,115,46,61,0,155,216,
+60,96,106,47,61,0,176,229,60,32,239,46,61,64,213,237,60,192,57,44,61,128,156,243,60,224,176,39,61,128,2,243,60,224,65,35,61,64,187,243,60,32,0,30,61,192,113,241,60,160,159,24,61,0,150,235,60,32,176,19,61,128,4,233,60,0,196,12,61,0,29,225,60,160,27,7,
+61,128,187,218,60,0,253,0,61,192,110,212,60,128,25,246,60,64,247,203,60,192,14,233,60,64,77,196,60,64,159,221,60,128,90,187,60,0,170,209,60,0,196,178,60,64,58,198,60,192,98,172,60,0,213,186,60,128,173,163,60,128,205,177,60,192,186,154,60,64,228,167,60,
+128,160,147,60,64,159,158,60,128,122,138,60,128,160,147,60,128,53,129,60,128,20,139,60,128,108,119,60,192,229,131,60,0,108,106,60,128,226,113,60,128,85,91,60,128,104,102,60,0,240,79,60,0,95,90,60,128,34,66,60,128,156,77,60,0,15,55,60,0,164,61,60,128,
+27,45,60,0,195,49,60,0,16,31,60,128,0,37,60,128,63,26,60,0,95,27,60,128,53,14,60,0,229,15,60,128,129,6,60,0,112,10,60,0,129,247,59,0,12,255,59,0,88,247,59,0,62,228,59,0,137,220,59,0,122,226,59,0,74,205,59,0,168,195,59,0,118,196,59,0,168,195,59,0,7,173,
+59,0,121,187,59,0,234,162,59,0,67,171,59,0,196,153,59,0,48,160,59,0,44,143,59,0,202,148,59,0,57,146,59,0,183,137,59,0,28,121,59,0,53,129,59,0,20,113,59,0,74,116,59,0,36,94,59,0,58,109,59,0,48,84,59,0,188,78,59,0,178,79,59,0,196,77,59,0,10,62,59,0,222,
+57,59,0,72,38,59,0,208,41,59,0,60,48,59,0,230,30,59,0,188,17,59,0,32,25,59,0,136,14,59,0,74,3,59,0,120,7,59,0,126,15,59,0,132,255,58,0,152,253,58,0,44,247,58,0,74,3,59,0,88,225,58,0,176,233,58,0,48,238,58,0,216,229,58,0,28,188,58,0,68,175,58,0,52,168,
+58,0,16,172,58,0,8,190,58,0,48,177,58,0,60,150,58,0,12,181,58,0,136,133,58,0,112,153,58,0,56,159,58,0,128,127,58,0,96,122,58,0,240,124,58,0,184,154,58,0,60,141,58,0,104,128,58,0,8,138,58,0,176,129,58,0,184,87,58,0,120,59,58,0,40,67,58,0,224,65,58,0,216,
+92,58,0,224,74,58,0,88,36,58,0,216,92,58,0,192,51,58,0,200,24,58,0,32,231,57,0,136,5,58,0,160,156,57,0,48,49,58,0,232,47,58,0,16,249,57,0,32,195,57,0,176,1,58,0,8,53,58,0,176,215,57,0,208,238,57,0,168,28,58,0,48,159,57,0,96,41,57,0,176,233,57,0,64,236,
+57,0,128,246,56,0,232,38,58,0,208,6,58,0,128,246,56,0,192,179,57,0,120,41,58,0,96,146,57,0,224,202,57,0,16,26,58,0,144,210,57,0,16,154,57,0,80,200,57,0,224,56,57,0,96,41,57,0,16,172,57,0,240,148,57,0,160,174,57,0,32,103,57,0,224,166,57,0,32,31,57,0,128,
+133,57,0,16,172,57,0,160,87,57,0,96,0,57,0,128,5,57,0,16,136,57,0,64,205,56,0,176,197,57,0,192,161,57,0,32,67,57,0,128,56,56,0,32,231,57,0,224,97,57,0,0,164,55,0,96,41,57,0,96,77,57,0,240,148,57,0,128,133,57,0,64,108,57,0,192,51,57,0,64,164,56,0,240,
+130,57,0,48,141,57,0,80,182,57,0,0,26,57,0,192,184,56,0,64,205,56,0,96,113,57,0,128,133,56,0,64,164,56,0,192,51,57,0,224,56,57,0,128,118,56,0,144,228,57,0,96,128,57,0,0,62,57,0,96,77,57,0,128,151,57,0,96,113,57,0,32,31,57,0,176,233,57,0,192,225,56,0,
+0,118,55,0,48,159,57,0,192,51,57,0,128,133,57,0,192,51,57,0,128,246,57,0,224,97,57,0,32,195,57,0,48,177,57,0,48,141,57,0,0,62,57,0,224,184,57,0,32,103,57,0,192,184,56,0,208,220,57,0,112,169,57,0,96,128,57,0,144,210,57,0,224,56,57,0,64,36,57,0,224,20,
+57,0,16,136,57,0,80,164,57,0,192,225,56,0,128,118,57,0,128,215,56,0,0,164,54,0,240,225,57,0,64,36,57,0,0,120,183,0,112,169,57,0,176,233,57,0,32,103,57,0,128,5,57,0,144,228,57,0,0,98,184,0,96,128,57,0,48,141,57,0,240,130,57,0,224,97,57,0,96,128,57,0,64,
+36,57,0,64,164,56,0,32,103,57,0,96,77,57,0,224,97,57,0,192,133,184,0,128,133,57,0,160,156,57,0,64,36,57,0,128,118,57,0,224,97,57,0,0,118,55,0,0,205,55,0,96,146,57,0,0,226,184,0,32,31,57,0,32,31,57,0,128,118,56,0,176,197,57,0,224,202,57,0,64,36,57,0,224,
+20,57,0,208,143,57,0,128,133,56,0,240,130,57,0,0,26,57,0,192,184,56,0,192,184,56,0,192,143,56,0,48,141,57,0,96,41,57,0,192,51,57,0,160,123,57,0,192,143,56,0,128,56,56,0,240,148,57,0,128,205,184,0,0,206,183,0,128,151,57,0,96,128,57,0,0,144,184,0,128,215,
+56,0,176,215,57,0,128,5,57,0,0,62,57,0,0,208,57,0,0,154,56,0,64,36,57,0,112,169,57,0,96,0,57,0,0,164,54,0,128,133,57,0,0,164,54,0,192,15,57,0,224,166,57,0,0,120,183,0,128,246,56,0,0,154,56,0,80,164,57,0,144,210,57,0,0,226,184,0,16,172,57,0,160,156,57,
+0,128,97,56,0,128,82,57,0,64,205,56,0,0,119,184,0,0,164,54,0,224,202,57,0,128,133,57,0,224,56,57,0,224,202,57,0,64,108,57,0,0,120,183,0,48,177,57,0,80,164,57,0,0,190,57,0,16,136,57,0,240,225,57,0,240,130,57,0,0,62,57,0,48,141,57,0,240,130,57,0,64,72,
+57,0,224,184,57,0,128,246,56,0,192,225,56,0,168,10,58,0,224,184,57,0,128,56,56,0,192,92,57,0,64,108,57,0,192,143,56,0,192,225,56,0,128,118,57,0,112,169,57,0,96,223,57,0,96,146,57,0,160,10,57,0,128,133,56,0,32,103,57,0,160,46,57,0,96,77,57,0,0,120,183,
+0,0,154,56,0,64,236,56,0,32,103,57,0,32,231,57,0,192,143,56,0,224,202,57,0,176,233,57,0,160,123,57,0,160,46,57,0,80,164,57,0,0,62,57,0,128,174,56,0,192,51,57,0,16,136,57,0,128,215,56,0,32,31,57,0,160,87,57,0,224,20,57,0,32,31,57,0,96,146,57,0,128,118,
+56,0,64,36,57,0,224,184,57,0,0,118,55,0,0,154,56,0,48,177,57,0,64,108,57,0,0,36,55,0,32,67,57,0,192,161,57,0,64,36,57,0,64,205,56,0,224,97,57,0,0,0,0,0,0,36,55,0,160,138,57,0,192,92,57,0,0,165,183,0,128,133,57,0,192,51,57,0,0,62,57,0,128,0,185,0,0,26,
+57,0,0,36,55,0,128,56,56,0,48,141,57,0,192,184,56,0,160,123,57,0,64,72,57,0,160,156,57,0,0,77,56,0,0,164,55,0,128,118,57,0,64,164,56,0,128,174,56,0,32,103,57,0,128,205,184,0,128,246,56,0,192,51,57,0,64,108,57,0,128,77,185,0,0,144,184,0,0,165,183,0,0,
+118,55,0,96,77,57,0,0,206,183,0,0,57,184,0,0,120,183,0,128,118,56,0,0,120,183,0,128,215,56,0,160,87,57,0,128,56,56,0,128,164,184,0,128,5,57,0,128,15,56,0,128,236,184,0,160,87,57,0,0,57,185,0,0,247,183,0,128,56,56,0,0,120,183,0,128,118,56,0,0,57,184,0,
+128,174,56,0,192,246,184,0,128,56,56,0,160,123,57,0,128,56,56,0,160,82,185,0,240,130,57,0,64,236,56,0,64,67,185,0,128,118,56,0,64,195,184,0,64,31,185,0,0,164,55,0,192,184,56,0,0,247,183,0,128,56,56,0,128,97,56,0,64,236,56,0,128,113,185,0,192,225,56,0,
+224,56,57,0,0,165,183,0,64,164,56,0,0,195,56,0,128,246,56,0,192,46,185,0,64,236,56,0,192,92,57,0,0,120,183,0,160,5,185,0,176,138,185,0,32,26,185,0,96,36,185,0,0,36,56,0,0,206,183,0,0,77,56,0,128,164,184,0,192,46,185,0,64,195,184,0,128,215,56,0,64,205,
+56,0,0,16,184,0,192,184,56,0,0,62,57,0,128,77,185,0,192,143,56,0,192,51,57,0,0,206,183,0,192,215,184,0,0,57,184,0,0,206,183,0,208,161,185,0,128,77,184,0,0,36,55,0,128,36,184,0,96,0,57,0,64,164,56,0,128,236,184,0,0,120,183,0,0,57,184,0,64,195,184,0,96,
+0,57,0,16,154,57,0,0,38,183,0,128,36,184,0,96,0,57,0,0,0,0,0,128,15,56,0,128,36,184,0,0,154,56,0,128,164,184,0,0,119,184,0,0,195,56,0,0,36,55,0,96,77,57,0,32,31,57,0,0,26,57,0,0,164,54,0,192,92,57,0,0,77,56,0,192,174,184,0,0,246,55,0,128,77,185,0,32,
+62,185,0,192,184,56,0,0,195,56,0,192,133,184,0,192,215,184,0,0,164,55,0,0,21,185,0,0,57,184,0,128,56,56,0,192,174,184,0,192,246,184,0,0,195,56,0,0,247,183,0,160,118,185,0,128,41,185,0,192,51,57,0,96,72,185,0,0,120,183,0,0,246,55,0,192,133,184,0,128,5,
+57,0,0,120,183,0,0,57,184,0,192,184,56,0,0,38,183,0,0,164,55,0,0,119,184,0,0,120,183,0,0,36,55,0,0,226,184,0,0,144,184,0,0,205,55,0,128,215,56,0,64,31,185,0,0,57,184,0,0,38,183,0,0,149,185,0,192,174,184,0,128,97,56,0,160,118,185,0,128,133,56,0,64,164,
+56,0,224,15,185,0,128,5,57,0,64,36,57,0,128,36,184,0,0,246,55,0,32,31,57,0,128,36,184,0,0,144,184,0,64,164,56,0,0,119,184,0,128,113,185,0,192,184,56,0,0,195,56,0,0,57,184,0,192,46,185,0,64,164,56,0,128,56,56,0,0,57,185,0,0,77,56,0,0,26,57,0,192,87,185,
+0,128,246,56,0,64,205,56,0,128,164,184,0,128,56,56,0,128,174,56,0,64,195,184,0,0,98,184,0,0,118,55,0,0,165,183,0,128,164,184,0,0,62,57,0,192,215,184,0,128,36,184,0,0,36,56,0,0,38,183,0,0,57,185,0,0,165,183,0,0,118,55,0,64,103,185,0,192,184,56,0,112,187,
+57,0,0,118,55,0,0,247,183,0,0,205,55,0,64,205,56,0,0,154,56,0,128,77,184,0,96,0,57,0,0,98,184,0,224,20,57,0,128,151,57,0,192,174,184,0,128,133,56,0,192,225,56,0,0,118,55,0,0,247,183,0,192,225,56,0,0,120,183,0,0,38,183,0,32,31,57,0,0,62,57,0,96,72,185,
+0,128,77,184,0,0,247,183,0,0,36,55,0,192,15,57,0,224,20,57,0,0,16,184,0,64,31,185,0,192,225,56,0,0,38,183,0,0,154,56,0,0,36,55,0,96,0,57,0,128,15,56,0,0,118,55,0,64,236,56,0,128,118,56,0,32,67,57,0,128,133,57,0,0,144,184,0,0,36,55,0,224,97,57,0,0,226,
+184,0,128,118,56,0,64,108,57,0,128,118,57,0,192,174,184,0,0,246,55,0,0,195,56,0,128,41,185,0,0,246,55,0,0,26,57,0,160,118,185,0,0,36,56,0,128,215,56,0,128,236,184,0,32,26,185,0,32,62,185,0,0,119,184,0,160,210,185,0,0,0,0,0,128,5,57,0,160,10,57,0,224,
+97,57,0,192,15,57,0,0,0,0,0,128,133,56,0,0,195,56,0,0,36,55,0,128,236,184,0,0,120,183,0,96,41,57,0,128,164,184,0,0,164,54,0,192,184,56,0,96,36,185,0,96,36,185,0,160,10,57,0,144,133,185,0,128,118,56,0,128,174,56,0,64,31,185,0,0,36,56,0,0,195,56,0,0,120,
+183,0,64,236,56,0,0,26,57,0,128,215,56,0,128,0,185,0,192,215,184,0,0,77,56,0,128,82,57,0,0,57,184,0,0,120,183,0,0,77,56,0,0,36,56,0,0,165,183,0,16,154,57,0,0,98,184,0,96,108,185,0,16,136,57,0,0,131,185,0,224,51,185,0,0,168,182,0,192,215,184,0,192,87,
+185,0,64,36,57,0,128,77,184,0,128,113,185,0,0,36,55,0,128,133,56,0,192,143,56,0,64,154,184,0,128,82,57,0,128,82,57,0,128,118,56,0,192,51,57,0,128,97,56,0,128,0,185,0,64,205,56,0,128,246,56,0,128,15,56,0,0,165,183,0,128,36,184,0,0,206,183,0,0,164,55,0,
+0,164,55,0,128,174,56,0,0,120,183,0,32,195,57,0,16,208,185,0,220,159,58,0,104,26,59,0,48,49,58,0,192,133,184,0,236,12,59,0,66,4,59,0,156,183,58,0,52,220,58,0,144,228,58,0,52,229,58,0,200,161,58,0,104,232,58,0,172,199,58,0,60,150,58,0,236,218,58,0,100,
+189,58,0,156,183,58,0,96,207,58,0,92,164,58,0,240,130,57,0,96,41,57,0,112,169,57,0,96,0,57,0,96,77,57,0,128,133,57,0,192,225,56,0,0,26,57,0,192,161,57,0,0,246,55,0,160,174,57,0,160,156,57,0,64,72,57,0,80,200,57,0,0,195,56,0,32,213,57,0,96,41,57,0,96,
+41,57,0,0,208,57,0,0,26,57,0,192,143,56,0,0,208,57,0,0,62,57,0,0,57,185,0,16,154,57,0,128,246,56,0,0,118,55,0,224,97,57,0,16,136,57,0,0,205,55,0,64,205,56,0,144,210,57,0,0,168,182,0,192,225,56,0,0,205,55,0,96,0,57,0,128,97,56,0,32,31,57,0,160,123,57,
+0,128,215,56,0,16,136,57,0,192,215,184,0,128,41,185,0,0,165,183,0,96,41,57,0,192,143,56,0,64,236,56,0,128,246,56,0,192,179,57,0,64,164,56,0,128,174,56,0,128,118,56,0,192,51,57,0,160,87,57,0,0,206,183,0,64,164,56,0,16,136,57,0,224,97,57,0,192,15,57,0,
+160,46,57,0,16,136,57,0,64,72,57,0,0,118,55,0,0,154,56,0,16,154,57,0,128,82,57,0,160,10,57,0,176,197,57,0,64,236,56,0,32,103,57,0,208,15,58,0,192,161,57,0,64,108,57,0,112,169,57,0,0,190,57,0,128,118,57,0,192,15,57,0,48,141,57,0,80,164,57,0,144,192,57,
+0,160,174,57,0,80,164,57,0,96,113,57,0,96,241,57,0,16,172,57,0,192,92,57,0,112,169,57,0,32,195,57,0,96,41,57,0,160,174,57,0,16,154,57,0,96,77,57,0,96,77,57,0,80,182,57,0,128,56,56,0,128,97,56,0,160,156,57,0,128,82,57,0,96,41,57,0,128,174,56,0,32,195,
+57,0,128,174,56,0,192,15,57,0,224,56,57,0,128,151,57,0,32,31,57,0,224,202,57,0,160,87,57,0,240,148,57,0,192,161,57,0,192,51,57,0,208,143,57,0,0,190,57,0,224,56,57,0,32,67,57,0,96,41,57,0,208,220,57,0,128,118,57,0,128,174,56,0,48,141,57,0,128,118,56,0,
+96,128,57,0,16,172,57,0,0,26,57,0,0,195,56,0,208,143,57,0,192,161,57,0,192,15,57,0,192,15,57,0,80,182,57,0,112,205,57,0,128,5,57,0,240,148,57,0,128,215,56,0,128,215,56,0,128,151,57,0,192,225,56,0,128,215,56,0,160,156,57,0,176,233,57,0,32,103,57,0,32,
+103,57,0,32,231,57,0,224,56,57,0,128,118,56,0,224,166,57,0,96,77,57,0,0,246,55,0,64,236,57,0,240,243,57,0,80,164,57,0,128,174,56,0,208,15,58,0,0,195,56,0,240,225,57,0,224,97,57,0,32,67,57,0,128,5,57,0,48,141,57,0,80,182,57,0,96,113,57,0,96,146,57,0,208,
+238,57,0,0,118,55,0,240,130,57,0,208,6,58,0,128,97,56,0,192,184,56,0,240,130,57,0,176,215,57,0,128,246,56,0,16,172,57,0,80,164,57,0,128,5,57,0,16,172,57,0,64,4,58,0,96,0,57,0,128,151,57,0,240,225,57,0,240,130,57,0,160,87,57,0,104,0,58,0,232,47,58,0,96,
+77,57,0,48,159,57,0,192,51,57,0,160,123,57,0,0,190,57,0,248,2,58,0,16,136,57,0,112,187,57,0,144,210,57,0,64,218,57,0,16,136,57,0,64,218,57,0,16,154,57,0,128,151,57,0,176,197,57,0,208,143,57,0,128,151,57,0,16,172,57,0,224,166,57,0,128,97,56,0,144,210,
+57,0,160,138,57,0,32,67,57,0,64,72,57,0,80,200,57,0,160,174,57,0,160,87,57,0,0,208,57,0,128,118,57,0,96,113,57,0,96,128,57,0,112,205,57,0,128,118,56,0,48,141,57,0,160,87,57,0,128,118,57,0,128,133,57,0,96,223,57,0,64,205,56,0,128,246,56,0,0,0,0,0,0,118,
+55,0,64,195,184,0,64,72,57,0,0,190,57,0,0,0,0,0,0,164,54,0,32,103,57,0,64,36,57,0,160,46,57,0,64,236,57,0,64,72,57,0,96,0,57,0,96,223,57,0,96,223,57,0,64,72,57,0,0,62,57,0,208,238,57,0,128,82,57,0,240,130,57,0,48,159,57,0,192,161,57,0,192,15,57,0,160,
+156,57,0,192,51,57,0,224,56,57,0,192,143,56,0,224,184,57,0,192,51,57,0,128,118,57,0,96,0,57,0,128,133,57,0,224,56,57,0,128,133,57,0,24,8,58,0,0,38,183,0,128,246,56,0,32,195,57,0,96,41,57,0,0,195,56,0,240,225,57,0,128,36,184,0,0,118,55,0,224,20,57,0,80,
+164,57,0,192,143,56,0,104,0,58,0,64,108,57,0,96,41,57,0,64,218,57,0,32,103,57,0,192,215,184,0,0,26,57,0,128,5,57,0,64,236,56,0,0,62,57,0,128,151,57,0,0,195,56,0,96,128,57,0,112,169,57,0,96,41,57,0,16,136,57,0,112,169,57,0,208,220,57,0,192,184,56,0,208,
+143,57,0,32,231,57,0,0,26,57,0,0,164,54,0,192,161,57,0,96,41,57,0,160,123,57,0,112,187,57,0,192,92,57,0,0,120,183,0,32,67,57,0,144,192,57,0,128,56,56,0,192,225,56,0,112,169,57,0,64,205,56,0,64,36,57,0,96,77,57,0,160,87,57,0,64,72,57,0,176,197,57,0,48,
+159,57,0,160,87,57,0,128,133,57,0,32,67,57,0,128,5,57,0,160,138,57,0,80,182,57,0,240,148,57,0,0,62,57,0,192,92,57,0,160,46,57,0,128,133,56,0,144,192,57,0,224,97,57,0,160,87,57,0,176,233,57,0,96,77,57,0,192,184,56,0,192,51,57,0,240,130,57,0,192,174,184,
+0,192,15,57,0,160,156,57,0,224,97,57,0,0,206,183,0,128,118,56,0,0,195,56,0,64,108,57,0,240,148,57,0,112,187,57,0,160,10,57,0,224,20,57,0,48,177,57,0,32,67,57,0,160,10,57,0,0,190,57,0,0,62,57,0,0,154,56,0,128,174,56,0,0,154,56,0,32,67,57,0,80,182,57,0,
+192,15,57,0,192,225,56,0,64,164,56,0,64,236,56,0,96,41,57,0,32,103,57,0,16,154,57,0,64,154,184,0,0,0,0,0,64,108,57,0,128,133,56,0,128,246,56,0,0,195,56,0,160,138,57,0,128,164,184,0,160,123,57,0,32,103,57,0,128,133,56,0,192,225,56,0,96,41,57,0,0,36,56,
+0,0,120,183,0,224,184,57,0,160,138,57,0,0,246,55,0,32,31,57,0,160,46,57,0,192,15,57,0,0,195,56,0,128,174,56,0,0,165,183,0,80,164,57,0,160,174,57,0,96,128,57,0,128,15,56,0,16,154,57,0,160,46,57,0,128,118,56,0,192,51,57,0,64,164,56,0,64,236,56,0,128,15,
+56,0,208,220,57,0,0,98,184,0,0,62,57,0,112,205,57,0,192,225,56,0,160,87,57,0,128,215,56,0,64,205,56,0,128,77,184,0,192,15,57,0,192,51,57,0,0,154,56,0,192,184,56,0,192,179,57,0,0,36,55,0,64,164,56,0,128,97,56,0,0,36,55,0,0,26,57,0,240,148,57,0,0,164,54,
+0,192,10,185,0,32,26,185,0,192,133,184,0,192,246,184,0,128,82,57,0,128,56,56,0,0,118,55,0,160,46,57,0,224,184,57,0,192,143,56,0,128,82,57,0,224,166,57,0,192,15,57,0,0,118,55,0,0,118,55,0,64,164,56,0,192,143,56,0,64,72,57,0,128,56,56,0,0,16,184,0,192,
+10,185,0,0,62,57,0,0,247,183,0,192,215,184,0,0,119,184,0,96,0,57,0,0,38,183,0,96,113,57,0,160,46,57,0,0,120,183,0,128,97,56,0,0,164,55,0,96,36,185,0,64,236,56,0,0,205,55,0,0,205,55,0,192,133,184,0,192,15,57,0,128,205,184,0,96,41,57,0,128,97,56,0,0,118,
+55,0,0,205,55,0,160,123,57,0,96,128,57,0,0,164,55,0,0,247,183,0,0,77,56,0,0,119,184,0,128,15,56,0,128,215,56,0,0,195,56,0,128,15,56,0,128,133,56,0,128,118,57,0,0,195,56,0,160,46,57,0,128,97,56,0,128,15,56,0,96,36,185,0,128,215,56,0,32,31,57,0,128,36,
+184,0,0,164,54,0,112,128,185,0,192,46,185,0,0,246,55,0,128,236,184,0,0,98,184,0,0,206,183,0,96,0,57,0,0,36,55,0,128,77,184,0,0,77,56,0,32,136,185,0,128,0,185,0,0,206,183,0,32,26,185,0,0,168,182,0,0,57,184,0,0,246,55,0,192,225,56,0,0,206,183,0,192,51,
+57,0,64,154,184,0,128,77,184,0,0,164,55,0,64,164,56,0,128,77,184,0,128,164,184,0,0,185,184,0,192,215,184,0,128,41,185,0,0,120,183,0,0,57,185,0,0,165,183,0,0,206,183,0,128,236,184,0,0,57,184,0,0,16,184,0,0,247,183,0,0,16,184,0,128,5,57,0,224,15,185,0,
+128,205,184,0,64,205,56,0,0,36,56,0,128,0,185,0,64,67,185,0,160,10,57,0,0,226,184,0,144,133,185,0,0,0,0,0,160,82,185,0,0,21,185,0,128,118,56,0,0,185,184,0,32,154,185,0,128,118,56,0,96,0,57,0,128,118,56,0,0,144,184,0,96,77,57,0,0,247,183,0,0,119,184,0,
+192,133,184,0,64,195,184,0,0,144,184,0,192,225,56,0,0,206,183,0,96,36,185,0,128,97,56,0,128,118,56,0,0,185,184,0,64,67,185,0,64,164,56,0,0,57,184,0,0,185,184,0,128,236,184,0,128,236,184,0,64,195,184,0,32,154,185,0,192,225,56,0,224,143,185,0,128,164,184,
+0,128,5,57,0,192,10,185,0,64,205,56,0,160,87,57,0,64,154,184,0,128,236,184,0,128,133,56,0,96,0,57,0,0,36,56,0,64,72,57,0,0,185,184,0,128,97,56,0,128,246,56,0,128,97,56,0,0,21,185,0,0,0,0,0,0,26,57,0,0,21,185,0,0,185,184,0,128,133,56,0,128,77,184,0,192,
+246,184,0,64,236,56,0,64,164,56,0,128,164,184,0,128,36,184,0,96,77,57,0,128,15,56,0,128,15,56,0,128,41,185,0,128,118,56,0,0,168,182,0,0,205,55,0,192,215,184,0,192,51,57,0,0,16,184,0,0,36,55,0,64,67,185,0,192,143,56,0,32,62,185,0,32,26,185,0,96,41,57,
+0,128,97,56,0,160,5,185,0,0,98,184,0,96,41,57,0,96,146,57,0,64,103,185,0,64,31,185,0,32,31,57,0,128,118,56,0,0,36,55,0,0,246,55,0,0,77,56,0,32,31,57,0,128,133,56,0,0,247,183,0,128,77,184,0,128,56,56,0,0,77,56,0,128,113,185,0,64,164,56,0,96,36,185,0,0,
+36,56,0,0,205,55,0,128,133,56,0,112,128,185,0,96,128,57,0,0,119,184,0,64,31,185,0,0,195,56,0,160,156,57,0,0,144,184,0,224,92,185,0,0,144,184,0,160,10,57,0,128,77,184,0,192,10,185,0,0,185,184,0,160,10,57,0,192,133,184,0,0,0,0,0,0,0,0,0,192,215,185,0,160,
+82,185,0,192,133,184,0,0,119,184,0,128,246,56,0,160,5,185,0,160,5,185,0,160,46,57,0,192,133,184,0,0,98,184,0,96,182,185,0,0,247,183,0,0,205,55,0,128,97,56,0,128,97,56,0,0,165,183,0,128,113,185,0,64,205,56,0,192,215,184,0,0,131,185,0,0,165,183,0,0,195,
+56,0,224,15,185,0,64,159,185,0,160,5,185,0,224,92,185,0,192,15,57,0,160,10,57,0,0,226,184,0,128,113,185,0,128,174,56,0,192,246,184,0,128,77,185,0,224,51,185,0,192,174,184,0,96,72,185,0,0,21,185,0,0,165,183,0,128,236,184,0,32,136,185,0,32,31,57,0,64,154,
+184,0,144,246,185,0,0,206,183,0,0,131,185,0,224,92,185,0,0,226,184,0,0,154,56,0,0,36,55,0,160,10,57,0,64,164,56,0,0,0,0,0,0,247,183,0,0,36,55,0,224,92,185,0,0,144,184,0,144,133,185,0,192,246,184,0,176,174,185,0,64,31,185,0,128,15,56,0,128,36,184,0,0,
+26,57,0,128,205,184,0,32,62,185,0,192,174,184,0,192,225,56,0,192,15,57,0,0,164,54,0,0,119,184,0,0,36,55,0,128,164,184,0,32,103,57,0,64,205,56,0,64,164,56,0,0,131,185,0,0,77,56,0,128,15,56,0,0,246,55,0,32,103,57,0,64,205,56,0,64,154,184,0,64,236,56,0,
+80,164,57,0,128,56,56,0,0,26,57,0,128,174,56,0,0,118,55,0,32,31,57,0,0,168,182,0,0,226,184,0,0,164,54,0,128,5,57,0,128,36,184,0,96,41,57,0,0,164,55,0,192,51,57,0,0,77,56,0,0,205,55,0,16,136,57,0,64,164,56,0,128,36,184,0,64,236,56,0,0,16,184,0,0,206,183,
+0,32,103,57,0,0,77,56,0,128,246,56,0,0,118,55,0,128,118,56,0,0,26,57,0,160,10,57,0,192,51,57,0,160,10,57,0,32,67,57,0,176,197,57,0,192,51,57,0,0,247,183,0,0,26,57,0,128,82,57,0,192,51,57,0,64,72,57,0,64,164,56,0,192,133,184,0,192,15,57,0,48,141,57,0,
+96,72,185,0,128,77,184,0,192,143,56,0,0,185,184,0,64,31,185,0,96,128,57,0,64,164,56,0,0,119,184,0,224,56,57,0,96,146,57,0,128,5,57,0,160,10,57,0,48,177,57,0,64,36,57,0,0,57,184,0,16,172,57,0,224,184,57,0,64,236,56,0,128,133,57,0,32,103,57,0,32,31,57,
+0,208,238,57,0,0,62,57,0,192,51,57,0,80,182,57,0,64,218,57,0,128,215,56,0,64,236,56,0,240,148,57,0,32,195,57,0,80,164,57,0,32,67,57,0,208,238,57,0,240,148,57,0,0,62,57,0,208,220,57,0,0,195,56,0,32,103,57,0,224,184,57,0,160,46,57,0,0,62,57,0,112,205,57,
+0,64,236,56,0,0,120,183,0,192,51,57,0,96,223,57,0,80,164,57,0,16,136,57,0,16,172,57,0,160,123,57,0,16,136,57,0,224,202,57,0,0,190,57,0,224,166,57,0,128,5,57,0,16,249,57,0,0,77,56,0,16,172,57,0,96,0,57,0,224,97,57,0,224,56,57,0,160,87,57,0,32,31,57,0,
+0,154,56,0,64,36,57,0,224,202,57,0,192,143,56,0,192,161,57,0,192,92,57,0,160,10,57,0,224,184,57,0,192,92,57,0,192,225,56,0,16,136,57,0,192,161,57,0,128,246,56,0,192,161,57,0,80,164,57,0,0,144,184,0,0,36,56,0,208,143,57,0,248,2,58,0,96,128,57,0,176,197,
+57,0,80,182,57,0,240,148,57,0,32,31,57,0,64,36,57,0,192,51,57,0,160,10,57,0,32,195,57,0,32,103,57,0,128,118,56,0,224,20,57,0,192,161,57,0,64,72,57,0,96,41,57,0,160,174,57,0,176,215,57,0,128,82,57,0,24,8,58,0,32,31,57,0,96,113,57,0,0,62,57,0,128,118,57,
+0,192,161,57,0,96,0,57,0,160,174,57,0,0,246,55,0,192,51,57,0,128,133,57,0,16,249,57,0,160,138,57,0,64,72,57,0,64,108,57,0,128,133,56,0,0,154,56,0,160,123,57,0,24,17,58,0,240,148,57,0,48,159,57,0,160,10,57,0,16,136,57,0,160,174,57,0,128,82,57,0,64,108,
+57,0,112,205,57,0,64,236,56,0,0,62,57,0,96,113,57,0,160,156,57,0,128,15,56,0,200,24,58,0,104,0,58,0,96,41,57,0,160,87,57,0,208,143,57,0,64,236,57,0,80,182,57,0,176,197,57,0,192,51,57,0,112,205,57,0,160,156,57,0,160,174,57,0,112,169,57,0,16,136,57,0,112,
+187,57,0,224,97,57,0,128,215,56,0,144,228,57,0,160,156,57,0,240,148,57,0,96,128,57,0,208,220,57,0,64,108,57,0,16,172,57,0,0,208,57,0,128,246,56,0,224,20,57,0,32,67,57,0,208,143,57,0,224,97,57,0,0,62,57,0,96,41,57,0,192,225,56,0,208,143,57,0,224,184,57,
+0,192,161,57,0,128,246,56,0,32,195,57,0,128,215,56,0,192,51,57,0,112,187,57,0,128,133,57,0,160,87,57,0,160,123,57,0,192,92,57,0,128,56,56,0,16,136,57,0,128,174,56,0,224,92,185,0,32,103,57,0,128,174,56,0,0,246,55,0,128,133,56,0,32,103,57,0,0,118,55,0,
+0,246,55,0,128,118,57,0,96,146,57,0,96,113,57,0,176,233,57,0,64,218,57,0,192,225,56,0,96,223,57,0,192,92,57,0,32,103,57,0,240,130,57,0,144,192,57,0,160,156,57,0,0,36,56,0,112,205,57,0,192,92,57,0,0,119,184,0,240,243,57,0,224,166,57,0,128,82,57,0,224,
+166,57,0,112,205,57,0,128,174,56,0,192,51,57,0,144,228,57,0,0,168,182,0,0,247,183,0,16,154,57,0,32,195,57,0,128,5,57,0,32,31,57,0,0,62,57,0,0,16,184,0,128,56,56,0,64,164,56,0,32,62,185,0,96,128,57,0,240,148,57,0,48,159,57,0,64,164,56,0,16,136,57,0,0,
+154,56,0,48,141,57,0,32,67,57,0,48,141,57,0,96,0,57,0,160,138,57,0,0,26,57,0,128,36,184,0,64,108,57,0,64,108,57,0,64,36,57,0,128,215,56,0,128,118,57,0,224,97,57,0,128,5,57,0,64,72,57,0,160,174,57,0,0,205,55,0,224,56,57,0,48,177,57,0,128,133,56,0,0,0,
+0,0,128,118,57,0,128,133,57,0,0,62,57,0,208,143,57,0,32,103,57,0,160,138,57,0,48,141,57,0,144,228,57,0,64,4,58,0,160,87,57,0,128,133,57,0,160,156,57,0,128,133,57,0,32,103,57,0,64,236,56,0,96,113,57,0,192,92,57,0,0,26,57,0,192,10,185,0,96,77,57,0,32,195,
+57,0,160,10,57,0,96,128,57,0,176,233,57,0,32,195,57,0,224,20,57,0,160,156,57,0,96,41,57,0,64,72,57,0,176,215,57,0,128,82,57,0,32,67,57,0,96,113,57,0,160,87,57,0,128,118,56,0,0,77,56,0,32,213,57,0,32,67,57,0,128,174,56,0,208,220,57,0,128,56,56,0,224,56,
+57,0,96,146,57,0,64,164,56,0,64,205,56,0,160,46,57,0,160,156,57,0,160,10,57,0,160,123,57,0,16,136,57,0,64,36,57,0,128,5,57,0,48,141,57,0,64,36,57,0,128,246,56,0,32,195,57,0,0,205,55,0,96,41,57,0,48,141,57,0,128,133,57,0,0,164,55,0,128,5,57,0,128,118,
+57,0,32,31,57,0,64,205,56,0,32,67,57,0,96,0,57,0,0,0,0,0,192,143,56,0,224,20,57,0,192,215,184,0,0,168,182,0,16,136,57,0,0,247,183,0,128,56,56,0,64,36,57,0,128,133,56,0,192,215,184,0,0,0,0,0,192,215,184,0,0,36,55,0,128,246,56,0,128,15,56,0,128,15,56,0,
+16,136,57,0,96,0,57,0,128,118,56,0,128,118,56,0,160,46,57,0,224,184,57,0,0,118,55,0,192,143,56,0,0,16,184,0,64,205,56,0,128,174,56,0,64,236,56,0,96,36,185,0,0,195,56,0,0,164,55,0,0,36,55,0,0,206,183,0,32,31,57,0,64,36,57,0,128,97,56,0,160,10,57,0,192,
+184,56,0,192,133,184,0,0,206,183,0,208,143,57,0,128,133,56,0,224,56,57,0,160,123,57,0,64,205,56,0,128,246,56,0,192,51,57,0,0,26,57,0,128,164,184,0,0,36,55,0,0,118,55,0,128,174,56,0,160,5,185,0,0,168,182,0,96,0,57,0,128,174,56,0,128,246,56,0,0,247,183,
+0,96,77,57,0,64,154,184,0,0,16,184,0,0,185,184,0,0,16,184,0,192,174,184,0,0,21,185,0,0,118,55,0,64,195,184,0,0,246,55,0,64,164,56,0,0,0,0,0,0,226,184,0,192,143,56,0,0,206,183,0,0,149,185,0,128,77,184,0,160,10,57,0,0,246,55,0,128,77,185,0,0,26,57,0,128,
+15,56,0,128,113,185,0,32,67,57,0,64,164,56,0,224,15,185,0,0,164,55,0,128,5,57,0,96,0,57,0,0,247,183,0,0,247,183,0,32,26,185,0,224,51,185,0,64,205,56,0,128,164,184,0,128,133,56,0,96,128,57,0,240,148,57,0,0,168,182,0,64,72,57,0,0,164,55,0,0,57,185,0,0,
+57,185,0,96,113,57,0,192,143,56,0,224,15,185,0,224,166,57,0,64,236,56,0,192,143,56,0,128,215,56,0,64,205,56,0,128,236,184,0,128,174,56,0,0,118,55,0,128,36,184,0,128,97,56,0,0,168,182,0,192,51,57,0,0,0,0,0,32,67,57,0,128,5,57,0,112,223,185,0,0,195,56,
+0,64,36,57,0,0,21,185,0,0,164,55,0,64,164,56,0,0,119,184,0,128,77,184,0,192,15,57,0,160,5,185,0,0,247,183,0,96,36,185,0,64,236,56,0,64,154,184,0,0,57,184,0,128,5,57,0,64,154,184,0,224,56,57,0,224,97,57,0,64,67,185,0,192,143,56,0,0,164,54,0,32,154,185,
+0,96,108,185,0,224,56,57,0,0,164,55,0,128,164,184,0,192,184,56,0,0,119,184,0,0,98,185,0,64,236,56,0,128,5,57,0,128,164,184,0,192,10,185,0,0,165,183,0,64,195,184,0,128,236,184,0,128,77,184,0,0,98,184,0,224,15,185,0,128,41,185,0,0,57,184,0,128,164,184,
+0,0,98,184,0,0,77,56,0,0,98,184,0,0,120,183,0,192,184,56,0,224,51,185,0,112,128,185,0,192,46,185,0,0,118,55,0,128,77,184,0,0,119,184,0,96,36,185,0,0,119,184,0,32,62,185,0,128,82,57,0,0,120,183,0,192,246,184,0,0,247,183,0,192,174,184,0,96,72,185,0,0,57,
+184,0,0,168,182,0,224,143,185,0,0,38,183,0,0,118,55,0,192,246,184,0,192,143,56,0,192,143,56,0,128,77,185,0,64,195,184,0,96,77,57,0,0,120,183,0,128,56,56,0,32,31,57,0,64,236,56,0,0,119,184,0,96,72,185,0,192,15,57,0,224,51,185,0,0,16,184,0,128,118,56,0,
+192,215,184,0,144,151,185,0,128,164,184,0,32,136,185,0,192,197,185,0,224,15,185,0,0,164,55,0,192,215,184,0,0,57,184,0,96,0,57,0,0,195,56,0,192,123,185,0,128,97,56,0,192,10,185,0,128,41,185,0,0,164,54,0,64,236,56,0,192,246,184,0,192,184,56,0,0,165,183,
+0,0,165,183,0,0,206,183,0,128,56,56,0,192,46,185,0,192,133,184,0,128,56,56,0,64,154,184,0,0,98,184,0,0,165,183,0,64,154,184,0,0,144,184,0,192,246,184,0,112,146,185,0,176,156,185,0,0,154,56,0,224,15,185,0,0,98,185,0,0,119,184,0,224,20,57,0,128,236,184,
+0,0,21,185,0,192,46,185,0,0,120,183,0,240,184,185,0,144,151,185,0,0,77,56,0,224,92,185,0,128,236,184,0,0,57,184,0,160,5,185,0,0,205,55,0,0,118,55,0,32,136,185,0,144,133,185,0,0,0,0,0,32,136,185,0,0,57,185,0,128,97,56,0,128,174,56,0,0,185,184,0,0,120,
+183,0,192,51,57,0,0,16,184,0,128,113,185,0,224,20,57,0,192,215,184,0,64,31,185,0,128,77,184,0,64,36,57,0,128,0,185,0,0,164,55,0,0,118,55,0,128,205,184,0,192,133,184,0,0,16,184,0,128,0,185,0,32,26,185,0,64,236,56,0,128,0,185,0,192,10,185,0,0,247,183,0,
+0,246,55,0,160,118,185,0,0,154,56,0,0,165,183,0,16,208,185,0,0,185,184,0,0,168,182,0,128,236,184,0,128,77,184,0,0,206,183,0,0,16,184,0,0,16,184,0,0,154,56,0,128,236,184,0,128,56,56,0,192,143,56,0,0,36,56,0,0,21,185,0,160,5,185,0,128,5,57,0,0,226,184,
+0,160,118,185,0,0,98,184,0,0,144,184,0,128,77,185,0,0,168,182,0,128,77,184,0,0,168,182,0,192,184,56,0,64,31,185,0,96,0,57,0,0,165,183,0,224,97,57,0,32,26,185,0,64,154,184,0,128,56,56,0,128,133,56,0,0,246,55,0,128,174,56,0,112,128,185,0,64,195,184,0,128,
+0,185,0,128,5,57,0,128,164,184,0,128,236,184,0,0,168,182,0,0,165,183,0,0,205,55,0,32,31,57,0,0,185,184,0,0,21,185,0,128,236,184,0,0,98,184,0,128,113,185,0,64,103,185,0,192,246,184,0,0,246,55,0,64,195,184,0,192,225,56,0,224,15,185,0,32,26,185,0,192,15,
+57,0,192,10,185,0,32,62,185,0,192,225,56,0,128,246,56,0,0,226,184,0,192,215,184,0,0,164,54,0,192,143,56,0,224,20,57,0,0,120,183,0,0,168,182,0,96,36,185,0,64,236,56,0,64,103,185,0,64,67,185,0,96,36,185,0,0,195,56,0,0,168,182,0,224,20,57,0,120,50,58,0,
+82,11,59,0,104,128,58,0,0,205,55,0,144,228,58,0,80,252,58,0,104,0,59,0,64,193,58,0,244,191,58,0,24,197,58,0,68,175,58,0,184,163,58,0,68,236,58,0,196,179,58,0,40,204,58,0,16,163,58,0,212,238,58,0,248,115,58,0,228,193,58,0,88,36,58,0,192,215,184,0,0,77,
+56,0,240,130,57,0,128,133,56,0,0,36,55,0,64,108,57,0,160,10,57,0,192,143,56,0,128,215,56,0,64,72,57,0,0,164,54,0,128,246,56,0,128,246,56,0,0,26,57,0,0,195,56,0,96,0,57,0,64,205,56,0,64,195,184,0,0,144,184,0,128,133,56,0,64,164,56,0,0,164,54,0,160,87,
+57,0,128,5,57,0,64,154,184,0,128,56,56,0,128,118,56,0,0,131,185,0,160,10,57,0,0,57,185,0,128,56,56,0,128,97,56,0,64,164,56,0,128,164,184,0,128,5,57,0,0,164,55,0,224,20,57,0,0,144,184,0,64,36,57,0,64,205,56,0,96,77,57,0,128,133,56,0,224,97,57,0,64,164,
+56,0,192,133,184,0,192,179,57,0,0,165,183,0,224,97,57,0,64,218,57,0,0,246,55,0,192,143,56,0,80,200,57,0,160,10,57,0,64,154,184,0,0,36,55,0,64,108,57,0,128,36,184,0,0,62,57,0,0,195,56,0,0,205,55,0,0,154,56,0,48,177,57,0,160,46,57,0,0,36,55,0,128,133,57,
+0,240,130,57,0,0,246,55,0,192,92,57,0,0,26,57,0,224,20,57,0,0,26,57,0,16,136,57,0,128,82,57,0,160,46,57,0,0,62,57,0,96,128,57,0,224,20,57,0,160,10,57,0,0,36,56,0,0,168,182,0,224,56,57,0,224,56,57,0,64,36,57,0,128,118,56,0,96,128,57,0,192,225,56,0,128,
+15,56,0,160,10,57,0,0,154,56,0,0,118,55,0,160,46,57,0,64,205,56,0,64,36,57,0,192,184,56,0,64,72,57,0,96,41,57,0,160,10,57,0,0,195,56,0,224,97,57,0,0,164,55,0,240,148,57,0,80,200,57,0,128,56,56,0,224,166,57,0,0,195,56,0,0,205,55,0,128,5,57,0,112,205,57,
+0,48,159,57,0,128,118,56,0,96,113,57,0,96,77,57,0,80,164,57,0,96,0,57,0,160,87,57,0,0,195,56,0,96,77,57,0,128,97,56,0,128,77,184,0,0,26,57,0,160,156,57,0,240,148,57,0,192,184,56,0,64,36,57,0,224,20,57,0,128,77,184,0,128,118,56,0,80,182,57,0,128,133,56,
+0,240,130,57,0,64,36,57,0,192,15,57,0,128,174,56,0,64,108,57,0,128,56,56,0,0,120,183,0,96,113,57,0,160,46,57,0,0,168,182,0,0,144,184,0,48,177,57,0,64,205,56,0,160,10,57,0,176,215,57,0,0,168,182,0,128,174,56,0,48,141,57,0,160,10,57,0,128,174,56,0,64,36,
+57,0,176,197,57,0,192,92,57,0,224,56,57,0,32,31,57,0,128,97,56,0,16,172,57,0,80,164,57,0,0,120,183,0,224,56,57,0,192,161,57,0,128,118,57,0,96,113,57,0,224,97,57,0,128,118,57,0,0,36,55,0,160,138,57,0,240,148,57,0,128,133,56,0,0,246,55,0,160,174,57,0,96,
+113,57,0,128,151,57,0,16,136,57,0,128,151,57,0,0,226,184,0,96,146,57,0,64,236,56,0,0,246,55,0,80,182,57,0,160,156,57,0,0,164,55,0,64,108,57,0,192,92,57,0,0,205,55,0,240,148,57,0,32,103,57,0,112,169,57,0,192,143,56,0,16,172,57,0,32,31,57,0,128,118,56,
+0,48,177,57,0,192,179,57,0,64,72,57,0,192,92,57,0,96,0,57,0,128,174,56,0,0,77,56,0,192,179,57,0,224,202,57,0,0,77,56,0,160,156,57,0,208,220,57,0,192,15,57,0,16,154,57,0,128,5,57,0,192,15,57,0,160,46,57,0,128,133,57,0,64,236,56,0,160,138,57,0,96,223,57,
+0,32,31,57,0,192,184,56,0,160,174,57,0,80,182,57,0,0,38,183,0,64,195,184,0,240,130,57,0,0,119,184,0,0,185,184,0,160,10,57,0,128,174,56,0,0,246,55,0,128,118,57,0,208,143,57,0,128,215,56,0,96,146,57,0,16,172,57,0,0,57,184,0,0,164,55,0,0,195,56,0,128,77,
+184,0,0,164,55,0,128,133,56,0,64,164,56,0,0,118,55,0,32,67,57,0,96,77,57,0,96,113,57,0,160,46,57,0,144,228,57,0,96,41,57,0,48,141,57,0,96,146,57,0,128,164,184,0,64,205,56,0,0,62,57,0,128,5,57,0,96,128,57,0,0,36,56,0,224,20,57,0,96,77,57,0,0,62,57,0,128,
+133,57,0,160,87,57,0,160,156,57,0,32,67,57,0,16,154,57,0,160,156,57,0,16,172,57,0,224,56,57,0,224,184,57,0,32,195,57,0,192,161,57,0,96,113,57,0,16,136,57,0,240,148,57,0,0,36,56,0,192,15,57,0,160,174,57,0,128,118,57,0,192,143,56,0,224,20,57,0,160,156,
+57,0,192,184,56,0,128,82,57,0,160,156,57,0,0,36,55,0,192,161,57,0,64,205,56,0,64,236,56,0,192,161,57,0,128,82,57,0,0,36,56,0,64,36,57,0,96,128,57,0,0,57,184,0,64,108,57,0,16,136,57,0,32,26,185,0,128,133,56,0,64,164,56,0,64,236,56,0,0,246,55,0,0,57,184,
+0,128,151,57,0,0,77,56,0,128,164,184,0,128,118,56,0,128,246,56,0,64,164,56,0,0,26,57,0,96,128,57,0,128,15,56,0,0,16,184,0,64,36,57,0,32,103,57,0,128,236,184,0,128,174,56,0,64,67,185,0,128,133,56,0,128,246,56,0,224,20,57,0,0,38,183,0,192,51,57,0,48,141,
+57,0,192,51,57,0,128,118,56,0,128,15,56,0,128,56,56,0,128,15,56,0,48,159,57,0,160,123,57,0,224,20,57,0,32,103,57,0,160,174,57,0,128,5,57,0,96,223,57,0,224,97,57,0,160,87,57,0,160,10,57,0,48,159,57,0,64,36,57,0,64,108,57,0,160,138,57,0,128,133,57,0,32,
+103,57,0,224,166,57,0,16,136,57,0,0,62,57,0,224,20,57,0,192,133,184,0,0,164,54,0,0,38,183,0,64,103,185,0,128,77,185,0,128,97,56,0,192,92,57,0,32,62,185,0,0,98,184,0,0,77,56,0,128,36,184,0,160,10,57,0,32,31,57,0,96,0,57,0,0,185,184,0,224,20,57,0,16,136,
+57,0,64,72,57,0,0,168,182,0,192,246,184,0,224,56,57,0,0,154,56,0,0,195,56,0,160,87,57,0,64,177,185,0,192,184,56,0,128,133,57,0,0,16,184,0,96,0,57,0,96,113,57,0,0,26,57,0,0,205,55,0,0,190,57,0,224,56,57,0,224,56,57,0,48,177,57,0,192,15,57,0,0,57,184,0,
+0,185,184,0,32,31,57,0,0,120,183,0,128,36,184,0,32,26,185,0,128,15,56,0,64,103,185,0,192,225,56,0,32,26,185,0,0,16,184,0,0,205,55,0,192,225,56,0,0,120,183,0,192,15,57,0,0,247,183,0,128,164,184,0,128,15,56,0,192,15,57,0,64,67,185,0,32,26,185,0,0,118,55,
+0,128,205,184,0,128,56,56,0,224,15,185,0,0,165,183,0,128,113,185,0,32,62,185,0,64,205,56,0,192,87,185,0,0,205,55,0,192,225,56,0,192,87,185,0,128,97,56,0,192,184,56,0,0,168,182,0,128,77,185,0,0,247,183,0,160,87,57,0,128,77,185,0,0,36,56,0,192,123,185,
+0,160,82,185,0,0,36,55,0,128,77,184,0,224,92,185,0,0,38,183,0,0,36,56,0,0,118,55,0,0,185,184,0,160,46,57,0,0,246,55,0,128,77,184,0,0,118,55,0,128,133,56,0,0,119,184,0,0,36,56,0,64,164,56,0,128,174,56,0,128,164,184,0,128,174,56,0,0,62,57,0,0,164,54,0,
+192,15,57,0,0,36,56,0,64,154,184,0,128,0,185,0,0,185,184,0,96,36,185,0,128,118,56,0,0,164,54,0,96,36,185,0,0,119,184,0,0,21,185,0,64,67,185,0,128,56,56,0,192,184,56,0,64,31,185,0,0,144,184,0,128,97,56,0,64,108,57,0,128,36,184,0,64,195,184,0,128,246,56,
+0,224,20,57,0,192,246,184,0,0,246,55,0,0,119,184,0,176,174,185,0,64,154,184,0,64,177,185,0,128,205,185,0,0,57,184,0,64,236,56,0,0,131,185,0,32,136,185,0,192,215,184,0,192,133,184,0,128,164,184,0,0,16,184,0,0,164,54,0,128,236,184,0,0,154,56,0,192,225,
+56,0,224,15,185,0,64,205,56,0,96,72,185,0,128,41,185,0,32,172,185,0,0,119,184,0,224,92,185,0,128,0,185,0,128,5,57,0,224,51,185,0,128,169,185,0,224,15,185,0,0,118,55,0,0,0,0,0,192,10,185,0,0,226,184,0,96,108,185,0,64,195,184,0,0,120,183,0,64,154,184,0,
+128,205,184,0,0,118,55,0,128,205,184,0,0,98,184,0,128,236,184,0,128,187,185,0,64,141,185,0,224,92,185,0,128,164,184,0,64,159,185,0,64,195,184,0,128,246,56,0,192,10,185,0,0,36,56,0,192,184,56,0,128,236,184,0,160,192,185,0,0,118,55,0,128,41,185,0,0,165,
+183,0,144,133,185,0,160,10,57,0,0,98,185,0,0,131,185,0,0,149,185,0,0,149,185,0,96,72,185,0,0,144,184,0,32,136,185,0,128,97,56,0,32,31,57,0,0,57,185,0,176,156,185,0,192,246,184,0,0,38,183,0,128,77,185,0,0,77,56,0,128,236,184,0,0,21,185,0,96,0,57,0,128,
+77,184,0,128,36,184,0,112,146,185,0,192,133,184,0,224,15,185,0,128,41,185,0,160,118,185,0,160,46,57,0,0,21,185,0,32,62,185,0,0,119,184,0,0,206,183,0,64,31,185,0,96,0,57,0,0,98,185,0,144,151,185,0,0,98,185,0,128,77,184,0,112,128,185,0,0,16,184,0,64,195,
+184,0,128,113,185,0,128,77,184,0,192,15,57,0,0,205,55,0,192,133,184,0,32,136,185,0,160,118,185,0,112,128,185,0,192,87,185,0,128,0,185,0,0,120,183,0,160,5,185,0,128,97,56,0,32,62,185,0,128,236,184,0,0,119,184,0,64,164,56,0,0,119,184,0,96,0,57,0,0,16,184,
+0,192,87,185,0,0,247,183,0,224,51,185,0,144,151,185,0,0,120,183,0,224,15,185,0,64,159,185,0,224,15,185,0,128,246,56,0,128,15,56,0,64,31,185,0,64,154,184,0,128,246,56,0,96,36,185,0,128,97,56,0,64,31,185,0,128,77,184,0,0,144,184,0,224,15,185,0,64,103,185,
+0,0,185,184,0,0,16,184,0,128,77,185,0,16,208,185,0,64,177,185,0,0,57,184,0,0,57,184,0,0,164,54,0,128,77,184,0,192,10,185,0,32,26,185,0,128,36,184,0,0,120,183,0,0,226,184,0,64,154,184,0,64,195,184,0,0,131,185,0,192,215,184,0,32,26,185,0,224,92,185,0,192,
+215,184,0,128,118,56,0,0,98,185,0,64,31,185,0,128,215,56,0,240,166,185,0,96,36,185,0,192,184,56,0,128,164,184,0,64,154,184,0,0,206,183,0,192,10,185,0,128,41,185,0,224,97,57,0,128,118,56,0,0,57,185,0,0,226,184,0,112,146,185,0,192,10,185,0,192,246,184,
+0,128,15,56,0,128,36,184,0,192,215,184,0,192,184,56,0,0,131,185,0,32,62,185,0,192,246,184,0,64,31,185,0,128,113,185,0,0,165,183,0,192,215,184,0,32,154,185,0,112,128,185,0,64,67,185,0,128,164,184,0,0,149,185,0,64,195,184,0,0,16,184,0,0,185,184,0,128,133,
+56,0,128,236,184,0,160,118,185,0,0,119,184,0,128,41,185,0,240,184,185,0,0,185,184,0,0,154,56,0,0,195,56,0,192,133,184,0,0,154,56,0,0,98,184,0,64,154,184,0,64,31,185,0,0,205,55,0,0,77,56,0,160,82,185,0,64,72,57,0,0,165,183,0,128,118,56,0,0,247,183,0,0,
+168,182,0,32,62,185,0,0,246,55,0,0,247,183,0,176,156,185,0,0,144,184,0,128,0,185,0,144,133,185,0,80,218,185,0,128,118,56,0,0,165,183,0,128,215,56,0,128,77,184,0,32,26,185,0,64,195,184,0,0,226,184,0,0,38,183,0,32,154,185,0,0,206,183,0,64,154,184,0,192,
+133,184,0,192,246,184,0,128,133,56,0,0,226,184,0,64,159,185,0,128,246,56,0,0,164,54,0,0,98,184,0,0,247,183,0,0,185,184,0,0,98,185,0,0,36,55,0,128,236,184,0,160,118,185,0,128,56,56,0,0,205,55,0,128,0,185,0,192,143,56,0,160,87,57,0,0,0,0,0,0,165,183,0,
+192,143,56,0,128,5,57,0,160,5,185,0,0,185,184,0,192,184,56,0,0,119,184,0,160,10,57,0,32,67,57,0,128,205,184,0,64,205,56,0,0,38,183,0,96,113,57,0,64,164,56,0,0,36,56,0,128,215,56,0,128,0,185,0,208,143,57,0,192,161,57,0,224,56,57,0,192,246,184,0,128,246,
+56,0,128,118,56,0,128,15,56,0,96,113,57,0,0,0,0,0,128,36,184,0,64,31,185,0,160,10,57,0,0,38,183,0,0,195,56,0,0,154,56,0,0,0,0,0,0,77,56,0,0,246,55,0,0,164,54,0,128,97,56,0,80,182,57,0,64,164,56,0,0,36,56,0,96,113,57,0,0,26,57,0,0,36,55,0,64,205,56,0,
+0,164,55,0,0,98,184,0,0,26,57,0,32,103,57,0,224,97,57,0,128,56,56,0,128,5,57,0,208,143,57,0,160,10,57,0,16,154,57,0,64,218,57,0,128,118,56,0,160,46,57,0,224,56,57,0,0,185,184,0,0,247,183,0,128,82,57,0,128,5,57,0,64,108,57,0,192,92,57,0,224,20,57,0,192,
+246,184,0,160,46,57,0,0,26,57,0,64,236,56,0,96,41,57,0,0,26,57,0,160,10,57,0,192,184,56,0,96,41,57,0,0,195,56,0,0,246,55,0,192,225,56,0,224,97,57,0,0,205,55,0,0,195,56,0,0,154,56,0,0,120,183,0,96,0,57,0,128,118,57,0,0,246,55,0,64,36,57,0,0,62,57,0,0,
+164,55,0,128,118,56,0,192,15,57,0,128,246,56,0,0,120,183,0,128,82,57,0,0,38,183,0,0,120,183,0,128,118,56,0,0,164,55,0,64,154,184,0,128,236,184,0,0,246,55,0,192,184,56,0,0,164,55,0,64,236,56,0,192,179,57,0,64,236,56,0,64,205,56,0,80,164,57,0,128,5,57,
+0,0,98,184,0,192,174,184,0,0,165,183,0,128,36,184,0,16,136,57,0,128,23,58,0,96,41,57,0,176,197,57,0,224,166,57,0,32,31,57,0,64,164,56,0,32,103,57,0,64,36,57,0,128,118,56,0,192,179,57,0,128,133,57,0,128,36,184,0,128,118,57,0,96,113,57,0,192,92,57,0,224,
+166,57,0,0,208,57,0,64,108,57,0,0,62,57,0,128,82,57,0,0,57,184,0,224,56,57,0,112,205,57,0,96,0,57,0,0,57,184,0,128,151,57,0,208,143,57,0,0,154,56,0,96,77,57,0,192,15,57,0,0,0,0,0,192,15,57,0,160,138,57,0,96,41,57,0,0,164,54,0,96,113,57,0,192,184,56,0,
+128,215,56,0,0,164,55,0,192,225,56,0,0,168,182,0,128,15,56,0,240,225,57,0,64,205,56,0,160,123,57,0,48,141,57,0,240,148,57,0,64,72,57,0,192,51,57,0,32,195,57,0,64,205,56,0,224,97,57,0,96,77,57,0,128,174,56,0,224,97,57,0,96,128,57,0,128,97,56,0,96,146,
+57,0,176,215,57,0,0,77,56,0,192,215,184,0,96,223,57,0,192,161,57,0,160,10,57,0,224,202,57,0,240,148,57,0,96,128,57,0,96,146,57,0,224,20,57,0,0,118,55,0,64,236,56,0,48,141,57,0,48,159,57,0,96,41,57,0,192,179,57,0,224,56,57,0,64,236,56,0,160,174,57,0,32,
+213,57,0,192,15,57,0,48,177,57,0,112,169,57,0,224,56,57,0,96,41,57,0,96,0,57,0,128,151,57,0,128,118,57,0,128,82,57,0,224,184,57,0,0,168,182,0,16,136,57,0,48,159,57,0,208,143,57,0,160,46,57,0,128,174,56,0,192,51,57,0,160,87,57,0,224,184,57,0,96,113,57,
+0,0,144,184,0,64,205,56,0,128,118,56,0,128,97,56,0,0,246,55,0,0,246,55,0,96,108,185,0,96,0,57,0,96,128,57,0,128,133,56,0,192,51,57,0,64,108,57,0,64,72,57,0,128,97,56,0,160,156,57,0,64,236,56,0,192,225,56,0,16,154,57,0,48,159,57,0,192,161,57,0,48,141,
+57,0,64,108,57,0,192,225,56,0,240,130,57,0,160,156,57,0,32,67,57,0,64,236,56,0,128,133,57,0,208,143,57,0,224,20,57,0,192,92,57,0,16,136,57,0,128,15,56,0,128,15,56,0,64,236,56,0,192,51,57,0,0,36,56,0,192,143,56,0,96,41,57,0,0,120,183,0,224,20,57,0,96,
+41,57,0,128,215,56,0,32,31,57,0,0,195,56,0,96,41,57,0,128,133,56,0,48,141,57,0,0,36,55,0,0,144,184,0,16,172,57,0,0,26,57,0,128,97,56,0,176,1,58,0,128,118,57,0,0,185,184,0,160,10,57,0,160,174,57,0,128,174,56,0,192,51,57,0,32,31,57,0,96,146,57,0,160,87,
+57,0,160,123,57,0,32,103,57,0,128,82,57,0,144,210,57,0,224,20,57,0,192,15,57,0,64,236,56,0,16,136,57,0,192,15,57,0,128,97,56,0,128,133,57,0,160,174,57,0,32,103,57,0,192,51,57,0,0,247,183,0,64,236,56,0,192,92,57,0,128,82,57,0,128,174,56,0,0,36,55,0,128,
+215,56,0,0,77,56,0,128,118,56,0,128,151,57,0,32,67,57,0,128,164,184,0,48,141,57,0,16,136,57,0,128,5,57,0,128,174,56,0,160,46,57,0,64,164,56,0,192,215,184,0,0,195,56,0,32,67,57,0,48,141,57,0,48,141,57,0,64,36,57,0,0,0,0,0,64,164,56,0,240,148,57,0,64,164,
+56,0,240,148,57,0,160,10,57,0,0,98,184,0,0,118,55,0,160,46,57,0,64,72,57,0,96,77,57,0,48,141,57,0,128,215,56,0,0,164,54,0,64,108,57,0,128,82,57,0,128,118,57,0,192,161,57,0,0,164,55,0,192,92,57,0,192,184,56,0,48,141,57,0,0,77,56,0,0,185,184,0,160,174,
+57,0,32,31,57,0,0,205,55,0,128,133,56,0,128,133,56,0,64,72,57,0,0,168,182,0,96,0,57,0,192,225,56,0,0,36,55,0,128,97,56,0,0,154,56,0,128,97,56,0,112,169,57,0,64,154,184,0,128,133,56,0,192,51,57,0,96,128,57,0,192,51,57,0,64,72,57,0,0,195,56,0,32,103,57,
+0,64,154,184,0,128,82,57,0,0,0,0,0,0,205,55,0,192,51,57,0,96,0,57,0,0,119,184,0,0,26,57,0,0,16,184,0,128,15,56,0,0,98,184,0,128,5,57,0,128,118,56,0,0,247,183,0,160,10,57,0,128,174,56,0,32,67,57,0,128,133,56,0,192,143,56,0,0,118,55,0,64,154,184,0,128,
+215,56,0,0,98,184,0,0,38,183,0,80,200,57,0,128,15,56,0,128,215,56,0,48,159,57,0,0,205,55,0,0,131,185,0,96,113,57,0,128,118,56,0,192,46,185,0,0,246,55,0,128,82,57,0,0,36,56,0,160,46,57,0,96,0,57,0,64,31,185,0,0,164,55,0,96,146,57,0,64,154,184,0,32,103,
+57,0,96,77,57,0,64,195,184,0,0,118,55,0,0,195,56,0,0,119,184,0,64,67,185,0,128,5,57,0,192,51,57,0,128,36,184,0,192,246,184,0,224,20,57,0,0,185,184,0,0,36,56,0,160,46,57,0,112,146,185,0,128,36,184,0,0,36,55,0,224,15,185,0,144,151,185,0,0,36,55,0,64,205,
+56,0,128,77,184,0,96,113,57,0,128,246,56,0,192,46,185,0,128,205,184,0,0,205,55,0,160,118,185,0,128,113,185,0,0,168,182,0,0,119,184,0,64,31,185,0,192,133,184,0,0,62,57,0,0,247,183,0,0,246,55,0,0,0,0,0,128,41,185,0,0,206,183,0,0,36,56,0,0,246,55,0,0,98,
+184,0,32,67,57,0,0,165,183,0,128,77,184,0,96,36,185,0,0,36,55,0,0,206,183,0,0,247,183,0,0,168,182,0,64,31,185,0,32,62,185,0,0,57,185,0,0,98,184,0,0,98,185,0,128,5,57,0,0,77,56,0,96,164,185,0,0,21,185,0,0,16,184,0,0,154,56,0,0,57,184,0,128,77,184,0,128,
+164,184,0,0,57,184,0,128,36,184,0,96,72,185,0,128,205,184,0,0,144,184,0,0,36,56,0,0,57,184,0,128,36,184,0,0,120,183,0,128,97,56,0,160,46,57,0,64,195,184,0,64,164,56,0,0,120,183,0,0,168,182,0,32,26,185,0,0,118,55,0,0,164,55,0,0,185,184,0,224,15,185,0,
+128,36,184,0,128,118,56,0,128,77,184,0,64,195,184,0,0,119,184,0,32,26,185,0,32,154,185,0,0,247,183,0,128,97,56,0,0,164,55,0,128,0,185,0,192,225,56,0,64,103,185,0,160,82,185,0,192,174,184,0,192,87,185,0,64,67,185,0,0,206,183,0,128,133,56,0,64,154,184,
+0,192,225,56,0,224,143,185,0,0,185,184,0,0,246,55,0,128,164,184,0,128,77,185,0,64,67,185,0,128,118,56,0,64,141,185,0,176,138,185,0,0,144,184,0,0,119,184,0,128,77,185,0,0,164,54,0,0,21,185,0,216,6,186,0,0,246,55,0,64,154,184,0,128,0,185,0,0,168,182,0,
+0,57,185,0,192,87,185,0,0,21,185,0,0,77,56,0,192,246,184,0,64,141,185,0,192,133,184,0,0,38,183,0,208,179,185,0,224,15,185,0,128,97,56,0,176,156,185,0,0,119,184,0,0,226,184,0,64,195,184,0,0,57,185,0,128,77,184,0,0,77,56,0,192,246,184,0,192,10,185,0,0,
+118,55,0,224,51,185,0,192,46,185,0,128,118,56,0,128,236,184,0,192,87,185,0,64,164,56,0,128,0,185,0,0,226,184,0,0,168,182,0,224,51,185,0,64,36,57,0,0,118,55,0,224,92,185,0,224,143,185,0,96,108,185,0,32,26,185,0,192,10,185,0,160,118,185,0,128,174,56,0,
+0,185,184,0,224,92,185,0,0,195,56,0,0,119,184,0,176,156,185,0,0,16,184,0,64,103,185,0,32,136,185,0,160,82,185,0,64,67,185,0,32,62,185,0,0,38,183,0,0,118,55,0,96,36,185,0,192,46,185,0,0,77,56,0,0,36,55,0,128,118,56,0,0,118,55,0,128,41,185,0,0,57,185,0,
+0,21,185,0,0,144,184,0,64,103,185,0,0,247,183,0,128,77,184,0,96,108,185,0,128,169,185,0,64,154,184,0,192,123,185,0,0,119,184,0,0,36,56,0,192,184,56,0,192,215,184,0,64,67,185,0,0,98,184,0,96,36,185,0,192,133,184,0,0,206,183,0,0,164,54,0,128,246,56,0,128,
+236,184,0,128,41,185,0,0,57,184,0,0,38,183,0,192,133,184,0,224,92,185,0,128,77,184,0,0,16,184,0,192,87,185,0,0,185,184,0,192,92,57,0,64,67,185,0,64,67,185,0,0,165,183,0,64,141,185,0,64,159,185,0,64,236,56,0,112,128,185,0,144,133,185,0,224,20,57,0,192,
+143,56,0,64,67,185,0,96,36,185,0,0,168,182,0,0,77,56,0,128,77,185,0,128,56,56,0,96,72,185,0,208,161,185,0,224,92,185,0,224,15,185,0,0,185,184,0,160,5,185,0,64,67,185,0,160,82,185,0,128,236,184,0,0,119,184,0,208,161,185,0,0,131,185,0,96,0,57,0,0,226,184,
+0,64,31,185,0,0,165,183,0,128,82,57,0,128,36,184,0,224,15,185,0,192,10,185,0,160,118,185,0,128,236,184,0,0,36,56,0,128,97,56,0,128,41,185,0,0,36,55,0,64,103,185,0,128,77,185,0,128,236,184,0,0,57,185,0,192,123,185,0,128,56,56,0,192,10,185,0,192,10,185,
+0,64,31,185,0,0,164,54,0,160,82,185,0,192,10,185,0,0,185,184,0,0,0,0,0,0,119,184,0,96,36,185,0,0,246,55,0,64,36,57,0,192,246,184,0,0,226,184,0,0,98,185,0,0,149,185,0,128,246,56,0,32,62,185,0,160,82,185,0,0,36,56,0,0,154,56,0,192,123,185,0,64,31,185,0,
+192,46,185,0,96,108,185,0,0,21,185,0,0,205,55,0,192,46,185,0,208,179,185,0,160,192,185,0,192,10,185,0,64,195,184,0,0,185,184,0,128,236,184,0,64,67,185,0,0,57,184,0,0,247,183,0,192,246,184,0,0,21,185,0,128,164,184,0,0,98,185,0,128,164,184,0,128,77,184,
+0,0,16,184,0,32,62,185,0,128,215,56,0,64,72,57,0,0,246,55,0,0,98,184,0,0,206,183,0,192,87,185,0,128,77,184,0,96,77,57,0,0,57,184,0,0,119,184,0,112,146,185,0,128,36,184,0,128,41,185,0,96,41,57,0,160,82,185,0,112,86,58,0,84,28,59,0,8,53,58,0,224,56,57,
+0,44,247,58,0,148,4,59,0,208,247,58,0,216,229,58,0,56,211,58,0,52,220,58,0,100,189,58,0,68,227,58,0,84,182,58,0,12,181,58,0,248,182,58,0,252,173,58,0,84,182,58,0,72,166,58,0,108,171,58,0,80,164,57,0,192,246,184,0,224,56,57,0,0,246,55,0,0,144,184,0,64,
+72,57,0,192,225,56,0,0,120,183,0,0,154,56,0,160,10,57,0,0,16,184,0,0,118,55,0,0,38,183,0,192,225,56,0,0,57,184,0,224,56,57,0,64,72,57,0,64,205,56,0,0,164,55,0,208,143,57,0,0,16,184,0,0,36,55,0,128,82,57,0,0,226,184,0,0,247,183,0,64,164,56,0,0,36,56,0,
+0,164,54,0,80,164,57,0,160,87,57,0,128,118,56,0,160,5,185,0,64,72,57,0,224,51,185,0,0,164,54,0,32,31,57,0,0,119,184,0,32,103,57,0,192,225,56,0,0,246,55,0,96,0,57,0,128,151,57,0,64,72,57,0,0,36,55,0,128,174,56,0,192,225,56,0,192,215,184,0,0,154,56,0,224,
+56,57,0,192,184,56,0,0,119,184,0,224,97,57,0,128,118,56,0,0,0,0,0,64,164,56,0,128,82,57,0,192,15,57,0,128,5,57,0,192,184,56,0,0,77,56,0,0,154,56,0,48,159,57,0,128,215,56,0,64,164,56,0,128,118,57,0,96,41,57,0,0,120,183,0,0,118,55,0,0,205,55,0,96,41,57,
+0,192,143,56,0,64,164,56,0,128,15,56,0,160,138,57,0,96,128,57,0,0,26,57,0,128,36,184,0,128,82,57,0,192,161,57,0,192,246,184,0,32,67,57,0,112,205,57,0,0,118,55,0,80,164,57,0,96,241,57,0,160,10,57,0,128,118,57,0,160,174,57,0,192,184,56,0,128,36,184,0,96,
+146,57,0,64,236,56,0,0,57,184,0,160,10,57,0,160,5,185,0,128,118,56,0,48,177,57,0,128,97,56,0,128,97,56,0,0,154,56,0,96,146,57,0,0,206,183,0,64,108,57,0,0,154,56,0,0,26,57,0,32,67,57,0,224,56,57,0,0,62,57,0,0,246,55,0,0,36,55,0,192,15,57,0,0,164,55,0,
+128,215,56,0,240,148,57,0,128,5,57,0,0,36,56,0,192,179,57,0,96,223,57,0,0,62,57,0,128,118,57,0,160,123,57,0,128,246,56,0,96,77,57,0,128,151,57,0,96,41,57,0,128,77,184,0,64,72,57,0,224,97,57,0,128,77,184,0,0,119,184,0,240,130,57,0,128,5,57,0,0,26,57,0,
+32,103,57,0,128,236,184,0,0,120,183,0,80,182,57,0,192,174,184,0,192,225,56,0,224,166,57,0,224,56,57,0,0,120,183,0,192,15,57,0,32,31,57,0,192,51,57,0,80,164,57,0,48,141,57,0,224,184,57,0,128,118,57,0,240,130,57,0,192,179,57,0,160,138,57,0,0,205,55,0,128,
+133,57,0,128,174,56,0,192,51,57,0,112,205,57,0,128,5,57,0,128,0,185,0,96,146,57,0,0,62,57,0,192,143,56,0,224,97,57,0,128,82,57,0,128,174,56,0,128,151,57,0,96,113,57,0,240,130,57,0,224,97,57,0,32,67,57,0,0,38,183,0,112,205,57,0,160,123,57,0,192,15,57,
+0,192,92,57,0,192,92,57,0,128,133,56,0,0,16,184,0,208,143,57,0,0,26,57,0,192,51,57,0,192,179,57,0,128,151,57,0,128,133,57,0,160,174,57,0,208,238,57,0,64,72,57,0,160,46,57,0,80,164,57,0,192,179,57,0,160,138,57,0,176,197,57,0,160,123,57,0,224,20,57,0,128,
+133,57,0,160,138,57,0,0,154,56,0,160,156,57,0,32,103,57,0,32,67,57,0,128,133,56,0,16,136,57,0,128,246,56,0,0,98,184,0,128,15,56,0,208,143,57,0,32,103,57,0,48,159,57,0,160,46,57,0,112,169,57,0,128,97,56,0,80,182,57,0,0,36,56,0,112,169,57,0,0,205,55,0,
+160,46,57,0,160,10,57,0,0,164,55,0,192,51,57,0,0,144,184,0,64,164,56,0,0,26,57,0,128,15,56,0,0,164,55,0,64,36,57,0,64,36,57,0,96,128,57,0,96,77,57,0,160,123,57,0,160,46,57,0,64,108,57,0,192,225,56,0,128,215,56,0,0,118,55,0,160,174,57,0,128,15,56,0,0,
+62,57,0,144,210,57,0,32,67,57,0,0,36,56,0,192,15,57,0,160,156,57,0,128,174,56,0,192,179,57,0,224,20,57,0,64,236,56,0,0,164,54,0,128,246,56,0,0,38,183,0,64,108,57,0,224,97,57,0,128,56,56,0,192,51,57,0,192,51,57,0,192,184,56,0,128,97,56,0,192,15,57,0,128,
+246,56,0,0,16,184,0,0,62,57,0,0,77,56,0,128,205,184,0,160,123,57,0,0,246,55,0,192,143,56,0,96,77,57,0,192,184,56,0,64,36,57,0,96,41,57,0,96,41,57,0,0,77,56,0,160,10,57,0,0,195,56,0,48,141,57,0,80,164,57,0,96,41,57,0,0,154,56,0,192,15,57,0,32,31,57,0,
+64,164,56,0,64,72,57,0,0,168,182,0,128,118,57,0,192,179,57,0,32,31,57,0,144,210,57,0,0,208,57,0,64,164,56,0,128,118,56,0,32,67,57,0,192,174,184,0,128,215,56,0,160,138,57,0,96,77,57,0,192,174,184,0,32,67,57,0,64,195,184,0,0,38,183,0,16,136,57,0,160,46,
+57,0,128,56,56,0,160,5,185,0,96,146,57,0,128,15,56,0,192,184,56,0,224,202,57,0,32,31,57,0,192,143,56,0,192,92,57,0,48,141,57,0,128,15,56,0,0,205,55,0,32,67,57,0,32,103,57,0,192,15,57,0,64,108,57,0,128,97,56,0,96,128,57,0,192,161,57,0,160,156,57,0,0,38,
+183,0,208,143,57,0,208,143,57,0,96,72,185,0,32,31,57,0,224,56,57,0,0,0,0,0,128,56,56,0,128,118,57,0,160,46,57,0,192,143,56,0,0,164,55,0,128,82,57,0,128,118,56,0,128,15,56,0,0,26,57,0,128,246,56,0,64,36,57,0,0,164,54,0,0,120,183,0,0,164,54,0,128,118,56,
+0,224,20,57,0,0,206,183,0,64,164,56,0,96,0,57,0,0,154,56,0,0,77,56,0,0,120,183,0,192,133,184,0,0,154,56,0,160,10,57,0,0,38,183,0,0,168,182,0,0,168,182,0,64,236,56,0,0,119,184,0,0,0,0,0,0,119,184,0,192,143,56,0,128,97,56,0,128,246,56,0,0,168,182,0,0,21,
+185,0,160,87,57,0,0,168,182,0,192,215,184,0,128,97,56,0,192,10,185,0,128,164,184,0,0,164,54,0,0,0,0,0,176,138,185,0,128,15,56,0,192,174,184,0,0,185,184,0,32,31,57,0,32,67,57,0,0,36,55,0,128,56,56,0,160,87,57,0,0,36,55,0,0,246,55,0,32,31,57,0,0,36,55,
+0,0,0,0,0,0,62,57,0,0,62,57,0,0,21,185,0,0,62,57,0,96,0,57,0,0,119,184,0,224,92,185,0,160,46,57,0,0,77,56,0,128,246,56,0,0,205,55,0,96,41,57,0,128,77,185,0,0,98,184,0,0,164,55,0,128,205,184,0,160,5,185,0,128,118,56,0,192,133,184,0,64,154,184,0,160,87,
+57,0,224,56,57,0,64,141,185,0,128,236,184,0,192,15,57,0,96,108,185,0,0,246,55,0,128,77,184,0,128,56,56,0,128,133,56,0,192,143,56,0,192,174,184,0,0,168,182,0,128,56,56,0,192,143,56,0,0,98,184,0,64,36,57,0,64,67,185,0,208,161,185,0,96,108,185,0,0,16,184,
+0,32,62,185,0,0,247,183,0,128,97,56,0,192,123,185,0,0,98,184,0,192,184,56,0,64,205,56,0,112,128,185,0,192,15,57,0,128,36,184,0,224,92,185,0,0,38,183,0,64,108,57,0,32,26,185,0,0,98,184,0,128,215,56,0,0,57,185,0,0,57,185,0,0,38,183,0,96,0,57,0,0,120,183,
+0,192,10,185,0,192,184,56,0,0,185,184,0,32,31,57,0,0,98,184,0,0,247,183,0,64,72,57,0,64,205,56,0,192,225,56,0,224,51,185,0,192,133,184,0,224,20,57,0,0,36,55,0,0,120,183,0,0,98,184,0,128,41,185,0,0,164,55,0,128,215,56,0,0,164,55,0,192,46,185,0,0,195,56,
+0,0,77,56,0,0,149,185,0,0,36,55,0,64,154,184,0,128,169,185,0,0,165,183,0,192,133,184,0,64,103,185,0,192,87,185,0,128,174,56,0,0,36,56,0,128,205,184,0,192,15,57,0,96,36,185,0,0,21,185,0,128,164,184,0,0,154,56,0,32,62,185,0,0,120,183,0,0,57,184,0,0,21,
+185,0,0,195,56,0,0,120,183,0,240,166,185,0,0,205,55,0,0,226,184,0,32,26,185,0,160,5,185,0,0,0,0,0,0,185,184,0,0,98,185,0,128,77,185,0,0,0,0,0,0,98,185,0,128,133,56,0,128,56,56,0,64,67,185,0,64,103,185,0,0,57,185,0,192,246,184,0,32,136,185,0,192,87,185,
+0,0,21,185,0,128,205,184,0,128,56,56,0,0,16,184,0,160,5,185,0,192,215,184,0,0,164,55,0,0,164,55,0,128,36,184,0,224,15,185,0,128,56,56,0,96,164,185,0,128,77,184,0,192,10,185,0,128,205,184,0,192,10,185,0,192,133,184,0,192,215,184,0,0,144,184,0,128,41,185,
+0,16,208,185,0,192,197,185,0,192,174,184,0,160,82,185,0,64,103,185,0,128,77,184,0,192,10,185,0,192,133,184,0,0,36,56,0,192,246,184,0,64,67,185,0,0,120,183,0,128,164,184,0,160,118,185,0,16,190,185,0,0,119,184,0,0,119,184,0,0,38,183,0,0,164,54,0,192,46,
+185,0,0,144,184,0,128,205,184,0,192,174,184,0,96,72,185,0,128,205,184,0,96,108,185,0,64,67,185,0,32,26,185,0,0,98,184,0,32,26,185,0,0,98,185,0,0,36,55,0,192,143,56,0,224,51,185,0,0,98,184,0,192,133,184,0,96,36,185,0,192,10,185,0,224,15,185,0,64,195,184,
+0,112,146,185,0,224,15,185,0,32,136,185,0,0,165,183,0,0,185,184,0,0,98,185,0,0,119,184,0,64,205,56,0,0,206,183,0,128,0,185,0,64,67,185,0,0,164,55,0,0,205,55,0,192,123,185,0,128,56,56,0,0,195,56,0,160,5,185,0,64,67,185,0,112,128,185,0,160,5,185,0,224,
+51,185,0,0,118,55,0,128,41,185,0,0,185,184,0,96,36,185,0,192,133,184,0,0,98,184,0,64,195,184,0,224,92,185,0,0,57,184,0,0,131,185,0,0,16,184,0,128,205,184,0,0,98,184,0,96,36,185,0,176,138,185,0,240,166,185,0,64,67,185,0,240,166,185,0,0,120,183,0,0,164,
+55,0,144,151,185,0,16,190,185,0,0,246,55,0,128,113,185,0,64,177,185,0,64,154,184,0,0,119,184,0,192,215,185,0,128,164,184,0,32,62,185,0,0,144,184,0,192,123,185,0,64,31,185,0,160,118,185,0,32,136,185,0,192,46,185,0,0,21,185,0,0,120,183,0,128,205,184,0,
+0,120,183,0,224,238,185,0,192,246,184,0,128,0,185,0,176,138,185,0,192,133,184,0,0,0,0,0,32,26,185,0,64,31,185,0,128,77,184,0,0,118,55,0,16,190,185,0,240,166,185,0,0,168,182,0,128,236,184,0,64,103,185,0,128,15,56,0,192,87,185,0,160,82,185,0,0,226,184,
+0,0,98,184,0,128,113,185,0,64,236,56,0,128,56,56,0,0,144,184,0,192,184,56,0,64,195,184,0,96,36,185,0,0,144,184,0,0,119,184,0,0,149,185,0,0,119,184,0,64,154,184,0,128,205,184,0,0,57,185,0,32,26,185,0,0,164,54,0,144,133,185,0,0,164,54,0,128,5,57,0,192,
+246,184,0,160,123,57,0,192,15,57,0,0,206,183,0,224,92,185,0,128,246,56,0,0,118,55,0,0,185,184,0,224,15,185,0,176,138,185,0,0,246,55,0,64,205,56,0,128,205,184,0,240,166,185,0,192,87,185,0,96,72,185,0,0,205,55,0,160,5,185,0,192,15,57,0,128,236,184,0,0,
+165,183,0,64,154,184,0,64,154,184,0,128,205,184,0,32,62,185,0,160,82,185,0,32,136,185,0,0,98,185,0,0,226,184,0,224,15,185,0,0,165,183,0,0,57,184,0,112,128,185,0,128,113,185,0,0,206,183,0,0,185,184,0,64,141,185,0,0,164,54,0,128,15,56,0,0,149,185,0,0,206,
+183,0,0,38,183,0,224,15,185,0,0,16,184,0,128,205,184,0,64,36,57,0,160,118,185,0,0,38,183,0,0,205,55,0,32,26,185,0,0,164,54,0,224,20,57,0,192,184,56,0,192,143,56,0,0,119,184,0,224,51,185,0,224,20,57,0,128,133,56,0,160,5,185,0,128,0,185,0,240,148,57,0,
+0,195,56,0,128,41,185,0,0,168,182,0,80,164,57,0,128,133,56,0,128,82,57,0,0,154,56,0,192,184,56,0,160,46,57,0,128,56,56,0,0,165,183,0,128,133,56,0,96,77,57,0,160,174,57,0,128,246,56,0,0,206,183,0,32,31,57,0,0,247,183,0,128,56,56,0,0,246,55,0,0,36,56,0,
+0,119,184,0,192,225,56,0,128,97,56,0,128,236,184,0,128,118,57,0,240,130,57,0,32,67,57,0,192,92,57,0,160,46,57,0,96,77,57,0,128,56,56,0,128,82,57,0,224,56,57,0,128,164,184,0,64,164,56,0,64,164,56,0,0,185,184,0,64,236,56,0,96,128,57,0,192,46,185,0,128,
+77,184,0,64,72,57,0,64,103,185,0,160,5,185,0,128,82,57,0,128,5,57,0,32,62,185,0,128,215,56,0,0,168,182,0,224,15,185,0,64,72,57,0,48,141,57,0,192,46,185,0,0,57,185,0,192,225,56,0,64,36,57,0,64,108,57,0,224,56,57,0,0,62,57,0,0,118,55,0,0,26,57,0,112,169,
+57,0,128,236,184,0,0,26,57,0,192,184,56,0,240,148,57,0,192,184,56,0,32,31,57,0,0,62,57,0,160,10,57,0,224,56,57,0,192,225,56,0,128,174,56,0,96,0,57,0,160,138,57,0,128,77,184,0,224,166,57,0,160,123,57,0,0,144,184,0,0,38,183,0,0,154,56,0,80,200,57,0,0,62,
+57,0,32,103,57,0,64,72,57,0,128,0,185,0,0,62,57,0,160,46,57,0,0,77,56,0,192,184,56,0,80,164,57,0,0,164,55,0,0,77,56,0,80,200,57,0,128,246,56,0,160,123,57,0,160,46,57,0,0,246,55,0,160,10,57,0,0,154,56,0,16,154,57,0,192,51,57,0,128,205,184,0,192,92,57,
+0,64,236,56,0,0,0,0,0,64,36,57,0,64,236,56,0,64,195,184,0,240,148,57,0,128,15,56,0,0,165,183,0,160,46,57,0,128,82,57,0,64,205,56,0,0,154,56,0,128,15,56,0,0,205,55,0,240,130,57,0,160,10,57,0,160,46,57,0,64,108,57,0,16,172,57,0,224,20,57,0,0,195,56,0,64,
+108,57,0,0,16,184,0,64,205,56,0,0,36,56,0,192,15,57,0,192,15,57,0,64,236,56,0,96,0,57,0,128,133,56,0,32,31,57,0,208,143,57,0,64,205,56,0,192,143,56,0,128,133,57,0,32,195,57,0,64,205,56,0,32,67,57,0,192,161,57,0,32,67,57,0,160,156,57,0,128,118,57,0,128,
+82,57,0,32,67,57,0,192,92,57,0,192,179,57,0,160,156,57,0,0,62,57,0,96,113,57,0,128,82,57,0,192,92,57,0,160,156,57,0,48,141,57,0,128,82,57,0,96,113,57,0,64,205,56,0,0,77,56,0,224,184,57,0,176,197,57,0,0,247,183,0,16,154,57,0,112,187,57,0,128,5,57,0,128,
+246,56,0,176,215,57,0,160,10,57,0,128,56,56,0,160,123,57,0,224,184,57,0,64,36,57,0,32,195,57,0,48,141,57,0,80,182,57,0,192,143,56,0,32,103,57,0,192,143,56,0,192,225,56,0,32,103,57,0,64,164,56,0,128,133,56,0,224,97,57,0,48,159,57,0,128,56,56,0,160,123,
+57,0,96,223,57,0,160,138,57,0,160,174,57,0,160,123,57,0,128,215,56,0,64,154,184,0,64,36,57,0,144,192,57,0,64,36,57,0,128,174,56,0,224,56,57,0,48,177,57,0,160,46,57,0,32,31,57,0,192,225,56,0,64,164,56,0,96,41,57,0,128,82,57,0,0,36,55,0,48,141,57,0,128,
+133,57,0,0,98,184,0,128,133,57,0,224,20,57,0,192,143,56,0,240,148,57,0,0,26,57,0,0,246,55,0,240,148,57,0,128,133,56,0,0,120,183,0,0,118,55,0,240,148,57,0,0,246,55,0,0,21,185,0,96,113,57,0,64,108,57,0,128,205,184,0,32,31,57,0,48,177,57,0,0,195,56,0,0,
+205,55,0,32,31,57,0,224,97,57,0,128,118,56,0,128,82,57,0,0,168,182,0,0,205,55,0,96,0,57,0,96,77,57,0,192,51,57,0,16,136,57,0,0,195,56,0,0,205,55,0,0,205,55,0,64,236,56,0,128,246,56,0,64,31,185,0,128,246,56,0,0,26,57,0,192,184,56,0,0,62,57,0,80,182,57,
+0,160,46,57,0,128,133,57,0,128,174,56,0,0,195,56,0,224,166,57,0,160,46,57,0,128,118,57,0,128,236,184,0,128,215,56,0,48,141,57,0,32,31,57,0,112,187,57,0,192,143,56,0,128,56,56,0,208,238,57,0,32,231,57,0,128,118,56,0,0,98,184,0,128,82,57,0,0,246,55,0,64,
+236,56,0,80,182,57,0,32,103,57,0,0,62,57,0,160,87,57,0,208,143,57,0,0,165,183,0,0,120,183,0,192,184,56,0,0,246,55,0,192,246,184,0,32,103,57,0,192,215,184,0,224,56,57,0,192,179,57,0,192,51,57,0,64,72,57,0,0,26,57,0,64,164,56,0,192,133,184,0,96,0,57,0,
+64,164,56,0,128,15,56,0,128,5,57,0,192,92,57,0,96,0,57,0,128,236,184,0,192,51,57,0,128,164,184,0,32,31,57,0,0,118,55,0,128,133,56,0,0,185,184,0,0,195,56,0,96,77,57,0,0,120,183,0,0,195,56,0,128,82,57,0,224,97,57,0,192,15,57,0,0,195,56,0,0,77,56,0,0,120,
+183,0,128,246,56,0,192,215,184,0,192,174,184,0,48,159,57,0,160,10,57,0,48,177,57,0,160,156,57,0,128,118,56,0,64,108,57,0,0,164,55,0,0,190,57,0,0,77,56,0,128,118,56,0,0,195,56,0,240,130,57,0,128,77,184,0,16,172,57,0,0,195,56,0,224,20,57,0,0,205,55,82,
+101,115,85,47,1,0,0,120,156,237,147,79,75,195,64,16,197,191,203,92,141,154,77,107,138,185,21,255,128,96,65,164,210,131,148,176,221,157,148,133,100,55,204,78,138,82,250,221,77,182,181,80,9,122,149,146,227,188,249,205,62,120,143,221,194,6,201,27,103,33,
+19,17,24,107,216,200,18,178,237,137,76,168,114,197,31,63,101,87,20,30,25,178,56,2,221,144,228,160,199,87,66,164,163,241,109,18,167,163,86,95,229,108,42,12,12,97,137,27,105,57,247,44,137,123,116,180,250,160,10,188,16,73,4,21,83,39,30,103,69,24,92,230,
+223,167,149,211,166,48,234,84,244,114,131,250,56,205,26,111,212,61,50,170,14,90,72,255,130,84,56,170,80,135,245,148,72,218,53,206,101,237,23,72,248,230,81,63,217,169,149,229,167,55,62,16,175,232,155,146,219,195,187,206,29,245,35,185,234,217,173,141,154,
+99,85,187,153,172,127,167,14,6,1,106,95,167,7,109,248,224,189,106,201,214,227,125,11,251,16,149,179,5,100,151,93,178,54,4,43,118,203,8,130,77,47,197,251,141,72,226,142,235,146,203,189,89,91,201,13,97,255,187,199,53,100,48,190,30,195,110,185,27,106,60,
+147,26,135,79,122,206,237,254,255,26,69,42,38,73,50,185,73,197,208,231,95,125,126,1,157,203,118,209,0,99,117,101,32,28,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,100,97,116,97,0,0,0,0,0,0,0,0,0,0,0,0,76,73,83,84,30,0,0,0,97,100,116,108,108,97,98,108,18,0,0,0,1,0,
+0,0,84,101,109,112,111,58,32,49,50,48,46,48,0,0,98,101,120,116,91,2,0,0,0,255,255,255,255,255,255,255,86,18,182,6,1,0,0,0,0,0,0,0,0,0,0,0,240,32,228,106,1,0,0,0,160,34,228,106,1,0,0,0,232,104,92,2,2,0,0,0,224,32,228,106,1,0,0,0,108,73,191,151,1,0,120,
+48,0,51,98,52,1,0,0,0,0,0,0,0,0,0,0,0,240,73,17,1,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,32,228,106,1,0,0,0,16,33,228,106,1,0,0,0,16,4,181,9,1,0,113,187,1,0,0,0,0,0,0,0,141,96,123,38,0,0,0,0,15,0,0,1,164,129,1,0,206,0,61,153,105,127,203,105,245,
+1,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,128,237,12,1,0,0,0,240,73,17,1,0,96,0,0,240,32,228,106,1,0,0,0,112,47,174,151,1,128,116,245,0,51,98,52,1,0,0,0,206,0,61,153,105,127,203,105,128,79,18,0,0,0,0,0,16,39,0,0,0,0,0,0,113,42,228,106,1,0,0,0,0,0,0,0,0,136,195,
+64,76,111,103,105,99,32,80,114,111,32,88,0,1,0,0,0,112,34,228,106,1,0,0,0,44,160,189,151,1,128,42,79,0,42,228,106,1,0,0,0,68,5,181,9,250,255,255,127,8,2,255,255,0,0,0,0,112,42,228,106,1,0,0,0,50,48,50,49,45,48,51,45,51,49,49,54,58,53,50,58,52,49,219,
+123,118,9,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,33,228,106,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
+
+const char* pedalAt12_wav = (const char*) temp_binary_data_1;
+
+//================== highGainLowDrive.wav ==================
+static const unsigned char temp_binary_data_2[] =
+{ 82,73,70,70,96,6,0,0,87,65,86,69,74,85,78,75,28,0,0,0,96,6,0,0,0,0,0,0,32,2,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,0,102,109,116,32,16,0,0,0,3,0,1,0,68,172,0,0,16,177,2,0,4,0,32,0,100,97,116,97,32,2,0,0,0,40,16,187,0,84,99,59,0,38,31,60,240,62,173,61,0,
+116,107,61,0,202,215,60,48,238,172,61,0,170,89,59,224,29,165,62,220,216,51,63,240,129,245,62,192,230,214,62,104,140,127,62,144,220,48,62,80,96,146,61,0,132,250,186,0,71,101,188,48,81,179,189,32,20,136,189,144,32,15,190,240,64,204,189,16,121,45,190,176,
+119,250,189,96,224,61,190,152,223,8,190,96,86,68,190,152,232,14,190,96,45,68,190,96,97,15,190,32,7,63,190,96,224,11,190,192,132,54,190,16,169,5,190,64,138,43,190,80,124,250,189,152,200,30,190,160,196,229,189,224,153,16,190,96,201,206,189,240,2,1,190,
+96,88,181,189,176,132,224,189,208,13,154,189,224,61,190,189,128,227,123,189,144,127,156,189,192,191,68,189,224,32,121,189,224,26,17,189,0,43,63,189,64,7,196,188,224,50,11,189,0,42,101,188,64,168,188,188,0,46,180,187,0,168,96,188,0,172,245,58,0,31,188,
+187,0,36,0,60,0,224,95,58,128,208,78,60,0,153,204,59,192,181,134,60,128,138,45,60,0,149,160,60,128,48,103,60,64,147,179,60,128,41,138,60,0,43,194,60,0,114,155,60,128,48,203,60,128,182,167,60,0,21,209,60,128,242,176,60,192,97,212,60,192,144,182,60,128,
+77,213,60,64,218,185,60,128,187,212,60,64,5,187,60,192,249,209,60,128,116,186,60,192,10,206,60,128,154,184,60,0,14,201,60,0,212,180,60,128,90,195,60,0,123,176,60,0,196,188,60,192,85,171,60,64,39,181,60,64,100,165,60,64,141,173,60,128,47,159,60,64,253,
+165,60,64,206,152,60,64,238,158,60,64,139,146,60,128,192,151,60,192,18,140,60,128,68,144,60,192,205,133,60,64,221,136,60,128,100,125,60,0,192,129,60,128,86,113,60,128,27,117,60,0,22,101,60,128,56,103,60,128,26,89,60,128,246,91,60,128,141,77,60,0,187,
+78,60,0,229,65,60,0,192,67,60,128,166,55,60,128,206,55,60,128,78,45,60,128,177,44,60,128,155,34,60,0,144,33,60,0,103,24,60,0,84,23,60,128,149,15,60,128,237,13,60,0,221,5,60,0,217,4,60,0,102,250,59,0,78,249,59,0,183,236,59,0,23,234,59,0,58,220,59,0,22,
+216,59,0,131,205,59,0,215,202,59,0,229,194,59,76,71,87,86,10,0,0,0,136,0,0,0,146,89,104,220,231,89,82,101,115,85,48,1,0,0,120,156,237,147,79,75,3,49,16,197,191,203,92,93,53,217,46,218,238,173,248,7,4,11,34,149,30,164,44,105,50,91,2,187,73,153,204,22,
+165,244,187,187,155,174,133,74,209,179,165,199,121,243,155,60,120,143,108,96,141,20,172,119,144,203,4,172,179,108,85,5,249,230,64,38,212,133,230,143,159,178,47,203,128,12,185,72,192,52,164,56,234,226,74,136,129,24,14,70,66,164,233,109,187,89,20,108,107,
+140,20,97,133,107,229,184,8,172,136,143,232,232,76,175,74,188,144,105,2,53,83,39,238,103,77,24,125,166,223,167,181,55,182,180,250,80,12,106,141,102,63,77,154,96,245,61,50,234,14,154,169,240,130,84,122,170,209,196,245,152,72,185,37,78,213,42,204,144,240,
+45,160,121,114,99,167,170,207,96,67,36,94,49,52,21,183,135,119,157,59,154,71,242,245,179,95,90,61,197,122,229,39,106,245,59,213,27,68,168,125,157,30,140,229,222,123,209,146,173,199,251,6,118,49,106,239,74,200,47,187,108,93,140,86,110,231,9,68,155,163,
+20,239,54,50,21,29,215,37,87,4,187,116,138,27,194,227,239,238,215,144,67,118,157,193,118,190,61,23,121,50,69,158,63,234,105,247,251,31,138,148,55,50,27,13,229,96,148,157,27,253,171,209,47,71,254,120,85,99,117,101,32,28,0,0,0,1,0,0,0,1,0,0,0,0,0,0,0,100,
+97,116,97,0,0,0,0,0,0,0,0,0,0,0,0,76,73,83,84,30,0,0,0,97,100,116,108,108,97,98,108,18,0,0,0,1,0,0,0,84,101,109,112,111,58,32,49,50,48,46,48,0,0,98,101,120,116,91,2,0,0,0,255,255,255,255,255,255,255,86,18,27,6,1,0,0,0,0,0,0,0,0,0,0,0,192,56,127,107,1,
+0,0,0,112,58,127,107,1,0,0,0,104,44,70,249,1,0,0,0,176,56,127,107,1,0,0,0,108,57,23,145,1,0,94,6,48,46,216,56,1,0,0,0,0,0,0,0,0,0,0,0,96,45,175,1,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,56,127,107,1,0,0,0,224,56,127,107,1,0,0,0,16,4,33,9,1,0,42,27,
+1,0,0,0,0,0,0,0,208,94,94,6,1,0,0,0,18,0,0,1,164,129,1,0,234,0,49,172,29,79,156,153,245,1,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,64,82,12,1,0,0,0,96,45,175,1,0,96,0,0,192,56,127,107,1,0,0,0,112,31,6,145,1,128,54,175,48,46,216,56,1,0,0,0,234,0,49,172,29,79,156,
+153,128,79,18,0,0,0,0,0,16,39,0,0,0,0,0,0,65,66,127,107,1,0,0,0,0,0,0,0,0,136,195,64,76,111,103,105,99,32,80,114,111,32,88,0,1,0,0,0,64,58,127,107,1,0,0,0,44,144,21,145,1,0,117,155,0,66,127,107,1,0,0,0,68,5,33,9,250,255,255,127,8,2,255,255,0,0,0,0,64,
+66,127,107,1,0,0,0,50,48,50,49,45,48,51,45,48,53,49,53,58,53,54,58,51,52,64,124,118,9,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,57,127,107,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
+
+const char* highGainLowDrive_wav = (const char*) temp_binary_data_2;
+
+//================== pedal_background.png ==================
+static const unsigned char temp_binary_data_3[] =
 { 137,80,78,71,13,10,26,10,0,0,0,13,73,72,68,82,0,0,6,131,0,0,4,226,8,6,0,0,1,6,200,170,95,0,0,0,9,112,72,89,115,0,0,46,35,0,0,46,35,1,120,165,63,118,0,0,32,0,73,68,65,84,120,156,236,189,7,152,28,213,149,54,124,170,170,243,228,145,70,18,201,224,5,155,160,
 128,18,136,156,149,9,130,209,8,141,16,2,99,156,119,215,254,246,243,239,101,63,175,13,152,245,191,246,62,187,223,239,93,219,136,104,68,210,72,26,9,3,2,27,176,137,2,36,64,152,32,114,80,70,210,104,52,169,103,166,115,85,253,207,185,161,250,118,117,143,18,
 211,61,221,61,231,133,82,87,87,135,169,170,183,223,123,206,61,247,220,115,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,32,16,8,4,2,129,64,
@@ -3455,7 +3746,7 @@ static const unsigned char temp_binary_data_1[] =
 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,87,13,162,31,94,251,80,40,116,
 189,0,0,0,0,73,69,78,68,174,66,96,130,0,0 };
 
-const char* pedal_background_png = (const char*) temp_binary_data_1;
+const char* pedal_background_png = (const char*) temp_binary_data_3;
 
 
 const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
@@ -3469,6 +3760,8 @@ const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
     switch (hash)
     {
         case 0xa14e6109:  numBytes = 23492; return pedalOverdrive_wav;
+        case 0x577be15b:  numBytes = 21602; return pedalAt12_wav;
+        case 0x9835b0a4:  numBytes = 1640; return highGainLowDrive_wav;
         case 0xab70c4fd:  numBytes = 225678; return pedal_background_png;
         default: break;
     }
@@ -3480,12 +3773,16 @@ const char* getNamedResource (const char* resourceNameUTF8, int& numBytes)
 const char* namedResourceList[] =
 {
     "pedalOverdrive_wav",
+    "pedalAt12_wav",
+    "highGainLowDrive_wav",
     "pedal_background_png"
 };
 
 const char* originalFilenames[] =
 {
     "pedalOverdrive.wav",
+    "pedalAt12.wav",
+    "highGainLowDrive.wav",
     "pedal_background.png"
 };
 
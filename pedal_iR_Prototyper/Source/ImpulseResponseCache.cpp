@@ -0,0 +1,238 @@
+/*
+  ==============================================================================
+
+    ImpulseResponseCache.cpp
+
+  ==============================================================================
+*/
+
+#include "ImpulseResponseCache.h"
+
+namespace
+{
+    //Drops the least recently used entries once there are more than maxEntries,
+    //leaving any that canEvict says are still needed
+    template <typename Entry, typename Predicate>
+    void evictLeastRecentlyUsed(std::vector<Entry>& entries, size_t maxEntries, Predicate canEvict)
+    {
+        while (entries.size() > maxEntries) {
+            auto oldest = entries.end();
+
+            for (auto entry = entries.begin(); entry != entries.end(); ++entry)
+                if (canEvict(*entry) && (oldest == entries.end() || entry->lastUsed < oldest->lastUsed))
+                    oldest = entry;
+
+            if (oldest == entries.end())
+                return;
+
+            entries.erase(oldest);
+        }
+    }
+}
+
+juce::String ImpulseResponseCache::getContentHash(const void* data, size_t dataSize)
+{
+    auto* bytes = static_cast<const juce::uint8*>(data);
+    juce::uint64 hash = 0xcbf29ce484222325ull;
+
+    for (size_t index = 0; index < dataSize; ++index) {
+        hash ^= bytes[index];
+        hash *= 0x100000001b3ull;
+    }
+
+    return juce::String::toHexString(static_cast<juce::int64>(hash)).paddedLeft('0', 16);
+}
+
+juce::String ImpulseResponseCache::addImpulseResponse(const void* data, size_t dataSize)
+{
+    auto impulseResponseId = getContentHash(data, dataSize);
+
+    const juce::ScopedLock scopedLock(lock);
+
+    for (auto& file : decodedFiles) {
+        if (file.impulseResponseId == impulseResponseId) {
+            file.lastUsed = ++useCounter;
+            return impulseResponseId;
+        }
+    }
+
+    DecodedFile file;
+    file.impulseResponseId = impulseResponseId;
+    file.buffer = PartitionedConvolver::readImpulseResponse(data, dataSize, file.sampleRate);
+    file.lastUsed = ++useCounter;
+
+    if (file.buffer.getNumSamples() == 0)
+        return {};
+
+    addDecodedFile(std::move(file));
+    return impulseResponseId;
+}
+
+juce::String ImpulseResponseCache::addPartitionedFile(const juce::File& file)
+{
+    //Hashing the contents would mean reading the whole file, which is what mapping it avoids
+    auto impulseResponseId = file.getFullPathName() + "@" + juce::String(file.getLastModificationTime().toMilliseconds())
+                           + ":" + juce::String(file.getSize());
+
+    const juce::ScopedLock scopedLock(lock);
+
+    if (getMappedFile(impulseResponseId) != nullptr)
+        return impulseResponseId;
+
+    auto partitionedFile = PartitionedImpulseResponseFile::open(file);
+
+    if (partitionedFile == nullptr)
+        return {};
+
+    //Every filter out of a mapping holds on to it, so one with only the cache's reference left
+    //has nothing convolving from it. Making room first means the new file is never the one to go
+    evictLeastRecentlyUsed(mappedFiles, maxMappedFiles - 1, [] (const MappedFile& entry) { return entry.file.use_count() == 1; });
+    mappedFiles.push_back({impulseResponseId, std::move(partitionedFile), ++useCounter});
+    return impulseResponseId;
+}
+
+std::shared_ptr<const PartitionedConvolver::Filter> ImpulseResponseCache::getFilter(const Key& key, const PartitionedConvolver::Layout& layout)
+{
+    const juce::ScopedLock scopedLock(lock);
+
+    for (auto& cached : filters) {
+        if (cached.key == key && cached.layout == layout) {
+            cached.lastUsed = ++useCounter;
+            return cached.filter;
+        }
+    }
+
+    CachedFilter cached;
+    cached.key = key;
+    cached.layout = layout;
+    cached.lastUsed = ++useCounter;
+
+    //Straight out of a pre-partitioned file if it was built with this rate, layout and conditioning
+    if (auto* mappedFile = getMappedFile(key.impulseResponseId)) {
+        if (mappedFile->isTrimmed() == key.trim && mappedFile->isNormalised() == key.normalise) {
+            cached.filter = mappedFile->getFilter(key.sampleRate, layout);
+        }
+    }
+
+    if (cached.filter == nullptr) {
+        auto* prepared = getPreparedImpulseResponse(key);
+
+        if (prepared == nullptr)
+            return nullptr;
+
+        auto layoutToUse = PartitionedConvolver::chooseLayout(layout, prepared->buffer.getNumSamples());
+        cached.filter = std::make_shared<const PartitionedConvolver::Filter>(prepared->buffer, layoutToUse);
+    }
+
+    filters.push_back(cached);
+    //A filter some instance still convolves with stays, dropping it would only mean
+    //building a second copy the next time another instance asks for it
+    evictLeastRecentlyUsed(filters, maxFilters, [] (const CachedFilter& entry) { return entry.filter.use_count() == 1; });
+
+    return cached.filter;
+}
+
+const ImpulseResponseCache::PreparedImpulseResponse* ImpulseResponseCache::getPreparedImpulseResponse(const Key& key)
+{
+    for (auto& prepared : preparedImpulseResponses) {
+        if (prepared.key == key) {
+            prepared.lastUsed = ++useCounter;
+            return &prepared;
+        }
+    }
+
+    auto* file = getDecodedFile(key.impulseResponseId);
+
+    if (file == nullptr)
+        return nullptr;
+
+    PreparedImpulseResponse prepared;
+    prepared.key = key;
+    prepared.buffer = PartitionedConvolver::prepareImpulseResponse(file->buffer, file->sampleRate, key.sampleRate, key.trim, key.normalise);
+    prepared.lastUsed = ++useCounter;
+
+    if (prepared.buffer.getNumSamples() == 0)
+        return nullptr;
+
+    preparedImpulseResponses.push_back(std::move(prepared));
+    //The newest entry is never the one evicted
+    evictLeastRecentlyUsed(preparedImpulseResponses, maxPreparedImpulseResponses, [] (const PreparedImpulseResponse&) { return true; });
+
+    return &preparedImpulseResponses.back();
+}
+
+const ImpulseResponseCache::DecodedFile* ImpulseResponseCache::getDecodedFile(const juce::String& impulseResponseId)
+{
+    for (auto& file : decodedFiles) {
+        if (file.impulseResponseId == impulseResponseId) {
+            file.lastUsed = ++useCounter;
+            return &file;
+        }
+    }
+
+    //A pre-partitioned file without the rate or layout asked for, its source samples are copied out once
+    if (auto* mappedFile = getMappedFile(impulseResponseId)) {
+        DecodedFile file;
+        file.impulseResponseId = impulseResponseId;
+        file.sampleRate = mappedFile->getSourceSampleRate();
+        file.buffer = mappedFile->getSourceImpulseResponse();
+        file.lastUsed = ++useCounter;
+
+        return &addDecodedFile(std::move(file));
+    }
+
+    return nullptr;
+}
+
+const ImpulseResponseCache::DecodedFile& ImpulseResponseCache::addDecodedFile(DecodedFile file)
+{
+    //Nothing refers to a decoded file once its prepared IRs are made, and every source can be
+    //decoded again. Making room first means the new file is never the one to go
+    evictLeastRecentlyUsed(decodedFiles, maxDecodedFiles - 1, [] (const DecodedFile&) { return true; });
+    decodedFiles.push_back(std::move(file));
+    return decodedFiles.back();
+}
+
+PartitionedImpulseResponseFile* ImpulseResponseCache::getMappedFile(const juce::String& impulseResponseId)
+{
+    for (auto& mapped : mappedFiles) {
+        if (mapped.impulseResponseId == impulseResponseId) {
+            mapped.lastUsed = ++useCounter;
+            return mapped.file.get();
+        }
+    }
+
+    return nullptr;
+}
+
+void ImpulseResponseCache::clear()
+{
+    const juce::ScopedLock scopedLock(lock);
+
+    decodedFiles.clear();
+    mappedFiles.clear();
+    preparedImpulseResponses.clear();
+    filters.clear();
+}
+
+size_t ImpulseResponseCache::getSizeInBytes() const
+{
+    const juce::ScopedLock scopedLock(lock);
+    size_t size = 0;
+
+    auto bufferSize = [] (const juce::AudioBuffer<float>& buffer)
+    {
+        return static_cast<size_t>(buffer.getNumChannels() * buffer.getNumSamples()) * sizeof(float);
+    };
+
+    for (const auto& file : decodedFiles)
+        size += bufferSize(file.buffer);
+
+    for (const auto& prepared : preparedImpulseResponses)
+        size += bufferSize(prepared.buffer);
+
+    for (const auto& cached : filters)
+        size += cached.filter->getSizeInBytes();
+
+    return size;
+}
@@ -0,0 +1,135 @@
+/*
+  ==============================================================================
+
+    ImpulseResponseCache.h
+
+    Keeps every step of getting an IR file ready to convolve so it only ever
+    happens once: the decoded file, the IR trimmed, resampled and normalised
+    for a sample rate, and the partitioned filter for a layout. Re-preparing
+    at a rate and layout that have been seen before is a lookup.
+
+    One cache is shared by every instance in the process through a
+    juce::SharedResourcePointer, so forty pedals in a session hold one decoded
+    IR and one set of partition spectra per sample rate and layout, and every
+    instance after the first starts with a lookup. It goes away with the last
+    instance. IRs are keyed by a hash of the file contents, so the same data
+    loaded from anywhere is only ever stored once.
+
+    Filters are handed out as shared pointers and never modified, so evicting
+    one never pulls it from under a convolver that still uses it. Every tier
+    keeps only the most recently used few, so auditioning a folder of
+    captures doesn't leave every one of them decoded. The loader adds its
+    source again before every build, so anything evicted is just decoded
+    again when it's next asked for.
+
+    Pre-partitioned .pir files are mapped rather than decoded. Their filters
+    come straight out of the mapping when the file has the rate and layout
+    asked for, otherwise the samples stored in it go the usual way. A mapping
+    no filter refers to any more is unmapped once there are more than a few.
+
+    All calls are thread safe but may allocate and run FFTs on a miss, keep
+    them off the audio thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PartitionedConvolver.h"
+#include "PartitionedImpulseResponseFile.h"
+
+class ImpulseResponseCache
+{
+public:
+    //Everything that makes one prepared IR different from another,
+    //impulseResponseId is what addImpulseResponse returned
+    struct Key
+    {
+        juce::String impulseResponseId;
+        double sampleRate = 0.0;
+        bool trim = true;
+        bool normalise = true;
+
+        bool operator== (const Key& other) const noexcept
+        {
+            return impulseResponseId == other.impulseResponseId && sampleRate == other.sampleRate
+                && trim == other.trim && normalise == other.normalise;
+        }
+    };
+
+    ImpulseResponseCache() = default;
+
+    //Decodes the file unless the same contents are already in the cache. Returns the id
+    //to look it up by, or an empty string if it can't be read
+    juce::String addImpulseResponse(const void* data, size_t dataSize);
+
+    //64 bit FNV-1a over the file, as hex
+    static juce::String getContentHash(const void* data, size_t dataSize);
+
+    //Maps a .pir file unless the same file, unchanged, is already mapped. Returns the id to
+    //look it up by, or an empty string if it isn't a valid one
+    juce::String addPartitionedFile(const juce::File& file);
+
+    //The filter for a decoded IR at a sample rate and layout, built if it isn't cached yet.
+    //Null if the id was never added or decoded to nothing
+    std::shared_ptr<const PartitionedConvolver::Filter> getFilter(const Key& key, const PartitionedConvolver::Layout& layout);
+
+    void clear();
+
+    size_t getSizeInBytes() const;
+
+private:
+
+    struct DecodedFile
+    {
+        juce::String impulseResponseId;
+        double sampleRate = 0.0;
+        juce::AudioBuffer<float> buffer;
+        juce::uint32 lastUsed = 0;
+    };
+
+    struct MappedFile
+    {
+        juce::String impulseResponseId;
+        std::shared_ptr<PartitionedImpulseResponseFile> file;
+        juce::uint32 lastUsed = 0;
+    };
+
+    struct PreparedImpulseResponse
+    {
+        Key key;
+        juce::AudioBuffer<float> buffer;
+        juce::uint32 lastUsed = 0;
+    };
+
+    struct CachedFilter
+    {
+        Key key;
+        PartitionedConvolver::Layout layout;
+        std::shared_ptr<const PartitionedConvolver::Filter> filter;
+        juce::uint32 lastUsed = 0;
+    };
+
+    const PreparedImpulseResponse* getPreparedImpulseResponse(const Key& key);
+    const DecodedFile* getDecodedFile(const juce::String& impulseResponseId);
+    const DecodedFile& addDecodedFile(DecodedFile file);
+    PartitionedImpulseResponseFile* getMappedFile(const juce::String& impulseResponseId);
+
+    //A handful of rates times a handful of layouts, anything past this is a host
+    //hopping around and the least recently used entries go
+    static constexpr size_t maxPreparedImpulseResponses = 8;
+    static constexpr size_t maxFilters = 16;
+    static constexpr size_t maxMappedFiles = 4;
+    static constexpr size_t maxDecodedFiles = 8;
+
+    mutable juce::CriticalSection lock;
+    juce::uint32 useCounter = 0;
+
+    std::vector<DecodedFile> decodedFiles;
+    std::vector<MappedFile> mappedFiles;
+    std::vector<PreparedImpulseResponse> preparedImpulseResponses;
+    std::vector<CachedFilter> filters;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImpulseResponseCache)
+};
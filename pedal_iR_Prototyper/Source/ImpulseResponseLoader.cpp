@@ -0,0 +1,147 @@
+/*
+  ==============================================================================
+
+    ImpulseResponseLoader.cpp
+
+  ==============================================================================
+*/
+
+#include "ImpulseResponseLoader.h"
+
+ImpulseResponseLoader::ImpulseResponseLoader()
+: juce::Thread("IR Loader")
+{
+    startThread();
+}
+
+ImpulseResponseLoader::~ImpulseResponseLoader()
+{
+    stopThread(4000);
+
+    freeConvolver(pendingConvolver);
+    freeConvolver(retiredConvolver);
+}
+
+bool ImpulseResponseLoader::preload(const Source& source)
+{
+    return addToCache(source).isNotEmpty();
+}
+
+std::unique_ptr<PartitionedConvolver> ImpulseResponseLoader::loadNow(const Request& request)
+{
+    //Only called while the audio thread is stopped, so both slots can go from here
+    {
+        const juce::ScopedLock lock(requestLock);
+        ++generation;
+        hasQueuedRequest = false;
+        freeConvolver(pendingConvolver);
+        freeConvolver(retiredConvolver);
+    }
+
+    return build(request);
+}
+
+void ImpulseResponseLoader::loadAsync(const Request& request)
+{
+    {
+        const juce::ScopedLock lock(requestLock);
+        queuedRequest = request;
+        hasQueuedRequest = true;
+    }
+
+    notify();
+}
+
+PartitionedConvolver* ImpulseResponseLoader::takeNextConvolver() noexcept
+{
+    if (retiredConvolver.load() != nullptr)
+        return nullptr;
+
+    return pendingConvolver.exchange(nullptr);
+}
+
+void ImpulseResponseLoader::retireConvolver(PartitionedConvolver* convolver) noexcept
+{
+    //Never full here, takeNextConvolver doesn't hand out another until it's been emptied
+    jassert(retiredConvolver.load() == nullptr);
+    retiredConvolver.store(convolver);
+}
+
+void ImpulseResponseLoader::run()
+{
+    while (! threadShouldExit()) {
+        freeConvolver(retiredConvolver);
+
+        Request request;
+        bool hasRequest = false;
+        int requestGeneration = 0;
+
+        {
+            const juce::ScopedLock lock(requestLock);
+            std::swap(hasRequest, hasQueuedRequest);
+            request = queuedRequest;
+            requestGeneration = generation;
+        }
+
+        if (! hasRequest) {
+            //Woken early by loadAsync, otherwise this is how often retired convolvers get freed
+            wait(100);
+            continue;
+        }
+
+        auto convolver = build(request);
+
+        if (convolver == nullptr)
+            continue;
+
+        const juce::ScopedLock lock(requestLock);
+
+        //loadNow ran while this was building, what it built is newer
+        if (requestGeneration != generation)
+            continue;
+
+        //Replaces one the audio thread never got round to taking
+        delete pendingConvolver.exchange(convolver.release());
+    }
+}
+
+juce::String ImpulseResponseLoader::addToCache(const Source& source)
+{
+    if (source.data != nullptr)
+        return cache->addImpulseResponse(source.data, source.dataSize);
+
+    if (source.file.hasFileExtension(PartitionedImpulseResponseFile::fileExtension))
+        return cache->addPartitionedFile(source.file);
+
+    juce::MemoryBlock fileData;
+
+    if (! source.file.loadFileAsData(fileData))
+        return {};
+
+    return cache->addImpulseResponse(fileData.getData(), fileData.getSize());
+}
+
+std::unique_ptr<PartitionedConvolver> ImpulseResponseLoader::build(const Request& request)
+{
+    auto impulseResponseId = addToCache(request.source);
+
+    if (impulseResponseId.isEmpty())
+        return nullptr;
+
+    ImpulseResponseCache::Key key;
+    key.impulseResponseId = impulseResponseId;
+    key.sampleRate = request.sampleRate;
+
+    auto filter = cache->getFilter(key, request.layout);
+
+    if (filter == nullptr)
+        return nullptr;
+
+    return std::make_unique<PartitionedConvolver>(std::move(filter), request.maximumBlockSize, request.numChannels,
+                                                  request.channelsPerGroup);
+}
+
+void ImpulseResponseLoader::freeConvolver(std::atomic<PartitionedConvolver*>& slot)
+{
+    delete slot.exchange(nullptr);
+}
@@ -0,0 +1,91 @@
+/*
+  ==============================================================================
+
+    ImpulseResponseLoader.h
+
+    Builds convolvers on a background thread and hands them to the audio
+    thread without locks. Reading a user file, decoding, resampling and the
+    partition FFTs all happen here (through the shared ImpulseResponseCache),
+    the audio thread only ever swaps a pointer.
+
+    Handover is two single slots: a finished convolver waits in pending until
+    the audio thread takes it, and the one it replaced is put in retired once
+    the audio thread is done with it, to be freed back on this thread.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PartitionedConvolver.h"
+#include "ImpulseResponseCache.h"
+
+class ImpulseResponseLoader : private juce::Thread
+{
+public:
+    //Where the IR comes from, either data held in memory for the plugin's lifetime
+    //(BinaryData) or a file that's read when the convolver is built
+    struct Source
+    {
+        const void* data = nullptr;
+        size_t dataSize = 0;
+        juce::File file;
+    };
+
+    struct Request
+    {
+        Source source;
+        PartitionedConvolver::Layout layout;
+        double sampleRate = 0.0;
+        int maximumBlockSize = 0;
+        int numChannels = 0;
+
+        //See PartitionedConvolver, 0 is one group
+        int channelsPerGroup = 0;
+    };
+
+    ImpulseResponseLoader();
+    ~ImpulseResponseLoader() override;
+
+    //Decodes a source into the shared cache ahead of time, returns false if it can't be read
+    bool preload(const Source& source);
+
+    //Builds the convolver right away on the calling thread, or returns null if the source
+    //can't be read. Anything pending is dropped, including a build already running.
+    //Only call it while the audio thread isn't processing, prepareToPlay for instance
+    std::unique_ptr<PartitionedConvolver> loadNow(const Request& request);
+
+    //Queues a background build, a newer request replaces one that hasn't started yet
+    void loadAsync(const Request& request);
+
+    //Audio thread: the newest finished convolver or null, ownership passes to the caller.
+    //Only returns one once the last retired convolver has been freed
+    PartitionedConvolver* takeNextConvolver() noexcept;
+
+    //Audio thread: hands back a convolver that's no longer used, freed on the loader thread
+    void retireConvolver(PartitionedConvolver* convolver) noexcept;
+
+private:
+
+    void run() override;
+
+    juce::String addToCache(const Source& source);
+    std::unique_ptr<PartitionedConvolver> build(const Request& request);
+    void freeConvolver(std::atomic<PartitionedConvolver*>& slot);
+
+    juce::SharedResourcePointer<ImpulseResponseCache> cache;
+
+    //Guards the queued request and generation, never taken by the audio thread
+    juce::CriticalSection requestLock;
+    Request queuedRequest;
+    bool hasQueuedRequest = false;
+
+    //Bumped by loadNow so a background build started before it is thrown away
+    int generation = 0;
+
+    std::atomic<PartitionedConvolver*> pendingConvolver { nullptr };
+    std::atomic<PartitionedConvolver*> retiredConvolver { nullptr };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImpulseResponseLoader)
+};
@@ -0,0 +1,554 @@
+/*
+  ==============================================================================
+
+    PartitionedConvolver.cpp
+
+  ==============================================================================
+*/
+
+#include "PartitionedConvolver.h"
+
+//==============================================================================
+//Direct form FIR over the first taps, delayed by the layout latency
+class PartitionedConvolver::HeadFilter
+{
+public:
+    //Taps come reversed from the filter so each output is one contiguous dot product over the history
+    HeadFilter(const Filter& filter, int delay, int firstChannelToUse, int numChannels)
+    : taps(filter.getHeadTaps()),
+      firstChannel(firstChannelToUse),
+      numTaps(filter.getHeadLength()),
+      length(filter.getHeadLength() + delay)
+    {
+        //Written twice so the last `length` samples are always contiguous
+        history.setSize(numChannels, length * 2);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        history.clear();
+        position = 0;
+    }
+
+    void process(const float* const* input, float* const* output, int numChannels, int numSamples) noexcept
+    {
+        int startPosition = position;
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            auto* tapData = taps[static_cast<size_t>(juce::jmin(firstChannel + channel, static_cast<int>(taps.size()) - 1))];
+            auto* historyData = history.getWritePointer(channel);
+            position = startPosition;
+
+            for (int sample = 0; sample < numSamples; ++sample) {
+                position = position + 1 == length ? 0 : position + 1;
+                historyData[position] = historyData[position + length] = input[channel][sample];
+
+                //Oldest of the taps' window first, the newest `delay` samples aren't used yet
+                auto* window = historyData + position + 1;
+                float sum0 = 0.0f, sum1 = 0.0f, sum2 = 0.0f, sum3 = 0.0f;
+                int tap = 0;
+
+                for (; tap + 4 <= numTaps; tap += 4) {
+                    sum0 += tapData[tap] * window[tap];
+                    sum1 += tapData[tap + 1] * window[tap + 1];
+                    sum2 += tapData[tap + 2] * window[tap + 2];
+                    sum3 += tapData[tap + 3] * window[tap + 3];
+                }
+
+                for (; tap < numTaps; ++tap)
+                    sum0 += tapData[tap] * window[tap];
+
+                output[channel][sample] += (sum0 + sum1) + (sum2 + sum3);
+            }
+        }
+    }
+
+private:
+    const std::vector<const float*>& taps;
+
+    int firstChannel = 0;
+    int numTaps = 0;
+    int length = 0;
+    int position = 0;
+
+    juce::AudioBuffer<float> history;
+};
+
+//==============================================================================
+//Uniformly partitioned overlap-save over one span of the IR. Output lags input by
+//blockSize, which the span's offset has already paid for
+class PartitionedConvolver::UniformStage
+{
+public:
+    UniformStage(const Filter::Partitions& partitions, int firstChannelToUse, int numChannels)
+    : filter(partitions),
+      firstChannel(firstChannelToUse),
+      blockSize(partitions.blockSize),
+      fftSize(partitions.blockSize * 2),
+      spectrumSize(Filter::getSpectrumSize(partitions.blockSize)),
+      numPartitions(partitions.numPartitions),
+      skippedPartitions(partitions.skippedPartitions),
+      delayLineSize(partitions.numPartitions + partitions.skippedPartitions),
+      irChannels(static_cast<int>(partitions.spectra.size())),
+      fft(juce::roundToInt(std::log2(partitions.blockSize * 2)))
+    {
+        fftBuffer.allocate(static_cast<size_t>(fftSize * 2), true);
+        accumulator.allocate(static_cast<size_t>(spectrumSize), true);
+
+        frames.setSize(numChannels, fftSize);
+        delayLine.setSize(numChannels, juce::jmax(1, delayLineSize) * spectrumSize);
+        outputBlocks.setSize(numChannels, blockSize);
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        frames.clear();
+        delayLine.clear();
+        outputBlocks.clear();
+        position = 0;
+        delayLineIndex = 0;
+    }
+
+    //Adds this stage's share of the convolution into output
+    void process(const float* const* input, float* const* output, int numChannels, int numSamples) noexcept
+    {
+        int done = 0;
+
+        while (done < numSamples) {
+            int numToCopy = juce::jmin(numSamples - done, blockSize - position);
+
+            for (int channel = 0; channel < numChannels; ++channel) {
+                juce::FloatVectorOperations::copy(frames.getWritePointer(channel, blockSize + position), input[channel] + done, numToCopy);
+                juce::FloatVectorOperations::add(output[channel] + done, outputBlocks.getReadPointer(channel, position), numToCopy);
+            }
+
+            position += numToCopy;
+            done += numToCopy;
+
+            if (position == blockSize) {
+                processFrame(numChannels);
+                position = 0;
+            }
+        }
+    }
+
+private:
+
+    void processFrame(int numChannels) noexcept
+    {
+        delayLineIndex = delayLineIndex + 1 == delayLineSize ? 0 : delayLineIndex + 1;
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            auto* frame = frames.getWritePointer(channel);
+            auto* spectra = delayLine.getWritePointer(channel);
+            auto* spectrum = filter.spectra[static_cast<size_t>(juce::jmin(firstChannel + channel, irChannels - 1))];
+
+            //The last two blocks of input, transformed into the newest delay line slot
+            juce::FloatVectorOperations::copy(fftBuffer, frame, fftSize);
+            juce::FloatVectorOperations::clear(fftBuffer + fftSize, fftSize);
+            fft.performRealOnlyForwardTransform(fftBuffer, true);
+            juce::FloatVectorOperations::copy(spectra + delayLineIndex * spectrumSize, fftBuffer, spectrumSize);
+
+            //Partition p of the filter meets the input from p + skippedPartitions frames ago
+            juce::FloatVectorOperations::clear(accumulator, spectrumSize);
+
+            for (int partition = 0; partition < numPartitions; ++partition) {
+                int slot = delayLineIndex - partition - skippedPartitions;
+
+                if (slot < 0)
+                    slot += delayLineSize;
+
+                multiplyAccumulate(accumulator, spectra + slot * spectrumSize, spectrum + partition * spectrumSize);
+            }
+
+            //Rebuild the negative frequencies and keep the second half, the first is wrapped around
+            juce::FloatVectorOperations::copy(fftBuffer, accumulator, spectrumSize);
+
+            for (int bin = 1; bin < blockSize; ++bin) {
+                fftBuffer[(fftSize - bin) * 2] = accumulator[bin * 2];
+                fftBuffer[(fftSize - bin) * 2 + 1] = -accumulator[bin * 2 + 1];
+            }
+
+            fft.performRealOnlyInverseTransform(fftBuffer);
+            juce::FloatVectorOperations::copy(outputBlocks.getWritePointer(channel), fftBuffer + blockSize, blockSize);
+
+            //The current block becomes the previous one
+            juce::FloatVectorOperations::copy(frame, frame + blockSize, blockSize);
+        }
+    }
+
+    //accumulator += a * b over the non-negative bins, interleaved complex
+    void multiplyAccumulate(float* destination, const float* a, const float* b) const noexcept
+    {
+        for (int index = 0; index < spectrumSize; index += 2) {
+            destination[index] += a[index] * b[index] - a[index + 1] * b[index + 1];
+            destination[index + 1] += a[index] * b[index + 1] + a[index + 1] * b[index];
+        }
+    }
+
+    const Filter::Partitions& filter;
+
+    int firstChannel = 0;
+    int blockSize = 0;
+    int fftSize = 0;
+    int spectrumSize = 0;
+    int numPartitions = 0;
+    int skippedPartitions = 0;
+    int delayLineSize = 0;
+    int irChannels = 1;
+
+    int position = 0;
+    int delayLineIndex = 0;
+
+    juce::dsp::FFT fft;
+    juce::HeapBlock<float> fftBuffer;
+    juce::HeapBlock<float> accumulator;
+
+    juce::AudioBuffer<float> frames;
+    juce::AudioBuffer<float> delayLine;
+    juce::AudioBuffer<float> outputBlocks;
+};
+
+//==============================================================================
+PartitionedConvolver::Layout PartitionedConvolver::getPresetLayout(Preset preset)
+{
+    Layout layout;
+
+    switch (preset) {
+        case zeroLatency:
+            //64 taps direct, then partitions growing so the big FFTs only cover the tail
+            layout.latency = 0;
+            layout.stages = {{64, 64}, {1024, 1024}};
+            break;
+        case lowLatency:
+            //Under 1 ms at 44.1 kHz and up, no direct head
+            layout.latency = 32;
+            layout.stages = {{32, 0}, {512, 512}};
+            break;
+        case balanced:
+            layout.latency = 256;
+            layout.stages = {{256, 0}, {2048, 2048}};
+            break;
+        case throughput:
+            layout.latency = 2048;
+            layout.stages = {{2048, 0}};
+            break;
+    }
+
+    return layout;
+}
+
+PartitionedConvolver::Layout PartitionedConvolver::chooseLayout(const Layout& layout, int impulseResponseLength)
+{
+    if (impulseResponseLength <= 0 || impulseResponseLength > maxDirectFormLength)
+        return layout;
+
+    //A stage starting past the end of the IR gets no partitions, so this is all head
+    Layout directForm;
+    directForm.latency = 0;
+    directForm.stages = {{juce::nextPowerOfTwo(impulseResponseLength + 1) / 2, impulseResponseLength}};
+    return directForm;
+}
+
+//==============================================================================
+PartitionedConvolver::Filter::Filter(const juce::AudioBuffer<float>& impulseResponse, const Layout& layoutToUse)
+: layout(layoutToUse),
+  impulseResponseLength(impulseResponse.getNumSamples())
+{
+    jassert(! layout.stages.empty());
+
+    auto irChannels = impulseResponse.getNumChannels();
+    headLength = juce::jmax(0, layout.stages.front().offset);
+
+    //Where each stage's span sits, worked out first so everything fits in one allocation
+    struct Span
+    {
+        int offset = 0;
+        int length = 0;
+        int padding = 0;
+    };
+
+    std::vector<Span> spans;
+    size_t storageSize = static_cast<size_t>(irChannels) * getAlignedSize(static_cast<size_t>(headLength));
+
+    for (size_t index = 0; index < layout.stages.size(); ++index) {
+        const auto& stage = layout.stages[index];
+        auto endOffset = index + 1 < layout.stages.size() ? layout.stages[index + 1].offset : impulseResponseLength;
+        auto blockSize = stage.blockSize;
+
+        jassert(juce::isPowerOfTwo(blockSize));
+        jassert(stage.offset + layout.latency >= blockSize);
+
+        //Emitting tap k of the span at stage.offset + latency after the input, with the stage's own
+        //blockSize lag, means the span starts that many samples minus blockSize into the filter.
+        //Whole empty partitions are skipped in the delay line rather than stored
+        int leadingZeros = stage.offset + layout.latency - blockSize;
+        Span span { stage.offset, juce::jmin(endOffset, impulseResponseLength) - stage.offset, leadingZeros % blockSize };
+
+        if (span.length <= 0)
+            continue;
+
+        Partitions stagePartitions;
+        stagePartitions.blockSize = blockSize;
+        stagePartitions.skippedPartitions = leadingZeros / blockSize;
+        stagePartitions.numPartitions = (span.padding + span.length + blockSize - 1) / blockSize;
+
+        storageSize += static_cast<size_t>(irChannels) * getAlignedSize(static_cast<size_t>(stagePartitions.numPartitions * getSpectrumSize(blockSize)));
+        spans.push_back(span);
+        partitions.push_back(std::move(stagePartitions));
+    }
+
+    storage.allocate(storageSize + alignmentInFloats, true);
+    auto* next = juce::snapPointerToAlignment(storage.get(), alignmentInFloats * sizeof(float));
+
+    for (int channel = 0; channel < irChannels && headLength > 0; ++channel) {
+        auto* source = impulseResponse.getReadPointer(channel);
+
+        for (int tap = 0; tap < headLength; ++tap)
+            next[tap] = headLength - 1 - tap < impulseResponseLength ? source[headLength - 1 - tap] : 0.0f;
+
+        headTaps.push_back(next);
+        next += getAlignedSize(static_cast<size_t>(headLength));
+    }
+
+    for (size_t index = 0; index < partitions.size(); ++index) {
+        auto& stagePartitions = partitions[index];
+        const auto& span = spans[index];
+        auto blockSize = stagePartitions.blockSize;
+        auto fftSize = blockSize * 2;
+        auto spectrumSize = getSpectrumSize(blockSize);
+
+        juce::dsp::FFT fft(juce::roundToInt(std::log2(fftSize)));
+        juce::HeapBlock<float> fftBuffer(static_cast<size_t>(fftSize * 2), true);
+
+        for (int channel = 0; channel < irChannels; ++channel) {
+            auto* source = impulseResponse.getReadPointer(channel);
+            auto* channelSpectra = next;
+            stagePartitions.spectra.push_back(channelSpectra);
+
+            for (int partition = 0; partition < stagePartitions.numPartitions; ++partition) {
+                juce::FloatVectorOperations::clear(fftBuffer, fftSize * 2);
+
+                for (int sample = 0; sample < blockSize; ++sample) {
+                    int tap = span.offset + partition * blockSize + sample - span.padding;
+
+                    if (tap >= span.offset && tap < span.offset + span.length)
+                        fftBuffer[sample] = source[tap];
+                }
+
+                fft.performRealOnlyForwardTransform(fftBuffer, true);
+                juce::FloatVectorOperations::copy(next, fftBuffer, spectrumSize);
+                next += spectrumSize;
+            }
+
+            next = channelSpectra + getAlignedSize(static_cast<size_t>(stagePartitions.numPartitions * spectrumSize));
+        }
+    }
+}
+
+PartitionedConvolver::Filter::Filter(const Layout& layoutToUse, int length, int numHeadTaps, std::vector<const float*> headTapsToUse,
+                                     std::vector<Partitions> partitionsToUse, std::shared_ptr<const void> ownerToUse)
+: layout(layoutToUse),
+  impulseResponseLength(length),
+  headLength(numHeadTaps),
+  headTaps(std::move(headTapsToUse)),
+  partitions(std::move(partitionsToUse)),
+  owner(std::move(ownerToUse))
+{
+}
+
+int PartitionedConvolver::Filter::getNumChannels() const noexcept
+{
+    if (! headTaps.empty())
+        return static_cast<int>(headTaps.size());
+
+    return partitions.empty() ? 0 : static_cast<int>(partitions.front().spectra.size());
+}
+
+size_t PartitionedConvolver::Filter::getSizeInBytes() const noexcept
+{
+    auto size = headTaps.size() * static_cast<size_t>(headLength);
+
+    for (const auto& stagePartitions : partitions)
+        size += stagePartitions.spectra.size() * static_cast<size_t>(stagePartitions.numPartitions * getSpectrumSize(stagePartitions.blockSize));
+
+    return size * sizeof(float);
+}
+
+//==============================================================================
+//A run of channels with everything that streams through them, the filter is shared
+struct PartitionedConvolver::ChannelGroup
+{
+    int firstChannel = 0;
+    int numChannels = 0;
+
+    std::unique_ptr<HeadFilter> head;
+    std::vector<std::unique_ptr<UniformStage>> stages;
+
+    //The stages add into the output, so they read the dry input from here
+    juce::AudioBuffer<float> dryInput;
+};
+
+PartitionedConvolver::PartitionedConvolver(std::shared_ptr<const Filter> filterToUse, int maximumBlockSize, int numChannels, int channelsPerGroup)
+: filter(std::move(filterToUse)),
+  latency(filter->getLayout().latency),
+  maxBlockSize(juce::jmax(1, maximumBlockSize))
+{
+    auto groupSize = juce::jlimit(1, maxGroupChannels, channelsPerGroup > 0 ? channelsPerGroup : numChannels);
+
+    for (int firstChannel = 0; firstChannel < numChannels; firstChannel += groupSize) {
+        auto group = std::make_unique<ChannelGroup>();
+        group->firstChannel = firstChannel;
+        group->numChannels = juce::jmin(groupSize, numChannels - firstChannel);
+
+        if (filter->getHeadLength() > 0 && ! filter->getHeadTaps().empty())
+            group->head = std::make_unique<HeadFilter>(*filter, latency, firstChannel, group->numChannels);
+
+        for (const auto& partitions : filter->getPartitions())
+            group->stages.push_back(std::make_unique<UniformStage>(partitions, firstChannel, group->numChannels));
+
+        group->dryInput.setSize(group->numChannels, maxBlockSize);
+        groups.push_back(std::move(group));
+    }
+}
+
+PartitionedConvolver::PartitionedConvolver(const juce::AudioBuffer<float>& impulseResponse, const Layout& layout, int maximumBlockSize, int numChannels,
+                                           int channelsPerGroup)
+: PartitionedConvolver(std::make_shared<const Filter>(impulseResponse, chooseLayout(layout, impulseResponse.getNumSamples())),
+                       maximumBlockSize, numChannels, channelsPerGroup)
+{
+}
+
+PartitionedConvolver::~PartitionedConvolver()
+{
+}
+
+void PartitionedConvolver::reset() noexcept
+{
+    for (auto& group : groups) {
+        if (group->head != nullptr)
+            group->head->reset();
+
+        for (auto& stage : group->stages)
+            stage->reset();
+    }
+}
+
+void PartitionedConvolver::process(juce::dsp::AudioBlock<float> block) noexcept
+{
+    for (int group = 0; group < getNumGroups(); ++group)
+        processGroup(group, block);
+}
+
+void PartitionedConvolver::processGroup(int groupIndex, juce::dsp::AudioBlock<float> block) noexcept
+{
+    auto& group = *groups[static_cast<size_t>(groupIndex)];
+    auto numChannels = juce::jmin(static_cast<int>(block.getNumChannels()) - group.firstChannel, group.numChannels);
+    auto numSamples = static_cast<int>(block.getNumSamples());
+    float* output[maxGroupChannels] = {};
+
+    if (numChannels <= 0)
+        return;
+
+    for (int startSample = 0; startSample < numSamples; startSample += maxBlockSize) {
+        auto numToProcess = juce::jmin(maxBlockSize, numSamples - startSample);
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            output[channel] = block.getChannelPointer(static_cast<size_t>(group.firstChannel + channel)) + startSample;
+            group.dryInput.copyFrom(channel, 0, output[channel], numToProcess);
+            juce::FloatVectorOperations::clear(output[channel], numToProcess);
+        }
+
+        auto* input = group.dryInput.getArrayOfReadPointers();
+
+        if (group.head != nullptr)
+            group.head->process(input, output, numChannels, numToProcess);
+
+        for (auto& stage : group.stages)
+            stage->process(input, output, numChannels, numToProcess);
+    }
+}
+
+//==============================================================================
+juce::AudioBuffer<float> PartitionedConvolver::readImpulseResponse(const void* data, size_t dataSize, double& fileSampleRate)
+{
+    juce::AudioFormatManager formatManager;
+    formatManager.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(std::make_unique<juce::MemoryInputStream>(data, dataSize, false)));
+
+    if (reader == nullptr)
+        return {};
+
+    juce::AudioBuffer<float> impulseResponse(static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples));
+    reader->read(&impulseResponse, 0, impulseResponse.getNumSamples(), 0, true, true);
+    fileSampleRate = reader->sampleRate;
+
+    return impulseResponse;
+}
+
+juce::AudioBuffer<float> PartitionedConvolver::prepareImpulseResponse(juce::AudioBuffer<float> impulseResponse, double fileSampleRate, double sampleRate,
+                                                                      bool trim, bool normalise)
+{
+    auto numChannels = impulseResponse.getNumChannels();
+
+    if (trim && impulseResponse.getNumSamples() > 0) {
+        const auto threshold = juce::Decibels::decibelsToGain(-80.0f);
+        int first = impulseResponse.getNumSamples(), last = 0;
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            auto* data = impulseResponse.getReadPointer(channel);
+
+            for (int sample = 0; sample < impulseResponse.getNumSamples(); ++sample) {
+                if (std::abs(data[sample]) > threshold) {
+                    first = juce::jmin(first, sample);
+                    last = juce::jmax(last, sample + 1);
+                }
+            }
+        }
+
+        if (first < last) {
+            juce::AudioBuffer<float> trimmed(numChannels, last - first);
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                trimmed.copyFrom(channel, 0, impulseResponse, channel, first, last - first);
+
+            impulseResponse = std::move(trimmed);
+        }
+    }
+
+    if (fileSampleRate > 0.0 && sampleRate > 0.0 && fileSampleRate != sampleRate && impulseResponse.getNumSamples() > 0) {
+        auto ratio = fileSampleRate / sampleRate;
+        auto resampledLength = juce::roundToInt(impulseResponse.getNumSamples() / ratio);
+
+        juce::MemoryAudioSource source(impulseResponse, false);
+        juce::ResamplingAudioSource resampler(&source, false, numChannels);
+        resampler.setResamplingRatio(ratio);
+        resampler.prepareToPlay(resampledLength, sampleRate);
+
+        juce::AudioBuffer<float> resampled(numChannels, resampledLength);
+        resampler.getNextAudioBlock(juce::AudioSourceChannelInfo(resampled));
+        impulseResponse = std::move(resampled);
+    }
+
+    if (normalise) {
+        float maxEnergy = 0.0f;
+
+        for (int channel = 0; channel < numChannels; ++channel) {
+            auto* data = impulseResponse.getReadPointer(channel);
+            float energy = 0.0f;
+
+            for (int sample = 0; sample < impulseResponse.getNumSamples(); ++sample)
+                energy += data[sample] * data[sample];
+
+            maxEnergy = juce::jmax(maxEnergy, energy);
+        }
+
+        if (maxEnergy > 0.0f)
+            impulseResponse.applyGain(0.125f / std::sqrt(maxEnergy));
+    }
+
+    return impulseResponse;
+}
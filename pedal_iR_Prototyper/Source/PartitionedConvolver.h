@@ -0,0 +1,174 @@
+/*
+  ==============================================================================
+
+    PartitionedConvolver.h
+
+    Non-uniform partitioned convolution for the pedal IR. The impulse response
+    is split into a direct form head, run sample by sample with no latency,
+    followed by one or more uniformly partitioned FFT stages (overlap-save with
+    a frequency domain delay line). Each stage works in blocks of its own size
+    and only starts where its block latency is already covered, so the output
+    is exactly the IR delayed by the layout's latency.
+
+    Small blocks mean low latency but many FFTs per second, big blocks mean
+    latency but fewer, cheaper passes over the IR. The presets cover live
+    (zero latency, or 32 samples) through to offline bounces.
+
+    The IR side (head taps and partition spectra) lives in a Filter that's
+    built once per IR, sample rate and layout and shared between convolvers,
+    see ImpulseResponseCache. A convolver only owns its streaming state.
+    That state is kept per group of channels, so big multichannel layouts
+    can convolve their groups on several threads.
+
+    Everything is allocated in the constructor, process() is real-time safe.
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class PartitionedConvolver
+{
+public:
+    //A uniform FFT stage covering the IR from offset up to the next stage's offset
+    struct Stage
+    {
+        int blockSize = 0;
+        int offset = 0;
+
+        bool operator== (const Stage& other) const noexcept { return blockSize == other.blockSize && offset == other.offset; }
+    };
+
+    //The head covers [0, first stage offset) in direct form. Every stage needs
+    //offset + latency >= blockSize, which is what lets it keep up
+    struct Layout
+    {
+        int latency = 0;
+        std::vector<Stage> stages;
+
+        bool operator== (const Layout& other) const noexcept { return latency == other.latency && stages == other.stages; }
+    };
+
+    enum Preset
+    {
+        zeroLatency = 0,
+        lowLatency,
+        balanced,
+        throughput
+    };
+
+    static Layout getPresetLayout(Preset preset);
+
+    //Up to this many taps a plain direct form FIR costs less than any partitioned layout
+    static constexpr int maxDirectFormLength = 128;
+
+    //The layout an IR of this length actually runs with: the one given, or for a short IR
+    //a direct form FIR over all of it, which also has no latency
+    static Layout chooseLayout(const Layout& layout, int impulseResponseLength);
+
+    //The IR cut up for one layout: reversed head taps and the spectra of every stage's partitions.
+    //Read only once built, so any number of convolvers on any thread can share one. The data
+    //is either owned or, for pre-partitioned files, refers straight into a memory mapped file
+    class Filter
+    {
+    public:
+        //One stage's spectra, numPartitions of blockSize + 1 interleaved complex bins, one array per IR channel
+        struct Partitions
+        {
+            int blockSize = 0;
+            int numPartitions = 0;
+            int skippedPartitions = 0;
+            std::vector<const float*> spectra;
+        };
+
+        //The IR must already be at the processing sample rate, see prepareImpulseResponse
+        Filter(const juce::AudioBuffer<float>& impulseResponse, const Layout& layout);
+
+        //Refers to taps and spectra held elsewhere, owner keeps them alive for as long as the filter is
+        Filter(const Layout& layout, int impulseResponseLength, int headLength, std::vector<const float*> headTaps,
+               std::vector<Partitions> partitions, std::shared_ptr<const void> owner);
+
+        const Layout& getLayout() const noexcept { return layout; }
+        int getImpulseResponseLength() const noexcept { return impulseResponseLength; }
+        int getNumChannels() const noexcept;
+
+        //No taps when the layout has no direct head
+        int getHeadLength() const noexcept { return headLength; }
+        const std::vector<const float*>& getHeadTaps() const noexcept { return headTaps; }
+        const std::vector<Partitions>& getPartitions() const noexcept { return partitions; }
+
+        //What the taps and spectra take up, wherever they're held
+        size_t getSizeInBytes() const noexcept;
+
+        static int getSpectrumSize(int blockSize) noexcept { return blockSize * 2 + 2; }
+
+    private:
+        Layout layout;
+        int impulseResponseLength = 0;
+        int headLength = 0;
+
+        std::vector<const float*> headTaps;
+        std::vector<Partitions> partitions;
+
+        //Every channel's head taps and every stage's spectra start on a 64 byte boundary, as in a .pir file.
+        //The block is over-allocated by one boundary's worth and the arrays start from the first aligned address
+        static constexpr size_t alignmentInFloats = 64 / sizeof(float);
+        static size_t getAlignedSize(size_t numFloats) noexcept { return (numFloats + alignmentInFloats - 1) / alignmentInFloats * alignmentInFloats; }
+
+        juce::HeapBlock<float> storage;
+        std::shared_ptr<const void> owner;
+
+        JUCE_DECLARE_NON_COPYABLE (Filter)
+    };
+
+    //Most channels one group holds
+    static constexpr int maxGroupChannels = 32;
+
+    //Mono IRs are used on every channel, otherwise channel n uses IR channel n (the last one
+    //past the IR's channel count). The channels are split into groups of channelsPerGroup,
+    //each with its own state and scratch, 0 keeps them all in one as far as maxGroupChannels
+    PartitionedConvolver(std::shared_ptr<const Filter> filter, int maximumBlockSize, int numChannels, int channelsPerGroup = 0);
+
+    //Builds its own filter, with the layout passed through chooseLayout
+    PartitionedConvolver(const juce::AudioBuffer<float>& impulseResponse, const Layout& layout, int maximumBlockSize, int numChannels,
+                         int channelsPerGroup = 0);
+    ~PartitionedConvolver();
+
+    int getLatencySamples() const noexcept { return latency; }
+    int getImpulseResponseLength() const noexcept { return filter->getImpulseResponseLength(); }
+    int getNumGroups() const noexcept { return static_cast<int>(groups.size()); }
+
+    void reset() noexcept;
+
+    //Convolves the block in place, any block size
+    void process(juce::dsp::AudioBlock<float> block) noexcept;
+
+    //Convolves only one group's channels of the block in place. Groups share nothing, so
+    //different groups can be processed on different threads at the same time
+    void processGroup(int group, juce::dsp::AudioBlock<float> block) noexcept;
+
+    //Decodes an audio file held in memory, returns an empty buffer if it can't be read
+    static juce::AudioBuffer<float> readImpulseResponse(const void* data, size_t dataSize, double& fileSampleRate);
+
+    //Same conditioning juce::dsp::Convolution does: strips silence below -80 dB from both ends,
+    //resamples to the processing rate and normalises the loudest channel's energy
+    static juce::AudioBuffer<float> prepareImpulseResponse(juce::AudioBuffer<float> impulseResponse, double fileSampleRate, double sampleRate,
+                                                           bool trim = true, bool normalise = true);
+
+private:
+
+    class HeadFilter;
+    class UniformStage;
+    struct ChannelGroup;
+
+    std::shared_ptr<const Filter> filter;
+
+    int latency = 0;
+    int maxBlockSize = 0;
+
+    std::vector<std::unique_ptr<ChannelGroup>> groups;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PartitionedConvolver)
+};
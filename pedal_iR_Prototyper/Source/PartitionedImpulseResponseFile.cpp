@@ -0,0 +1,327 @@
+/*
+  ==============================================================================
+
+    PartitionedImpulseResponseFile.cpp
+
+  ==============================================================================
+*/
+
+#include "PartitionedImpulseResponseFile.h"
+
+namespace
+{
+    juce::uint64 alignUp(juce::uint64 value, juce::uint64 alignment) noexcept
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    //Bytes between one channel's array and the next, so every channel starts aligned
+    juce::uint64 getChannelStride(juce::uint64 numFloats, juce::uint64 alignment) noexcept
+    {
+        return alignUp(numFloats * sizeof(float), alignment);
+    }
+}
+
+//==============================================================================
+std::shared_ptr<PartitionedImpulseResponseFile> PartitionedImpulseResponseFile::open(const juce::File& file)
+{
+    auto mappedFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly, false);
+
+    if (mappedFile->getData() == nullptr)
+        return nullptr;
+
+    std::shared_ptr<PartitionedImpulseResponseFile> partitionedFile(new PartitionedImpulseResponseFile(std::move(mappedFile)));
+
+    if (! partitionedFile->isValid())
+        return nullptr;
+
+    return partitionedFile;
+}
+
+PartitionedImpulseResponseFile::PartitionedImpulseResponseFile(std::unique_ptr<juce::MemoryMappedFile> mappedFile)
+: mapping(std::move(mappedFile))
+{
+    static_assert(sizeof(FileHeader) == 64, "The file header is part of the format");
+    static_assert(sizeof(EntryHeader) == 296, "The entry header is part of the format");
+    static_assert(maxStages == 8, "The entry header is part of the format");
+
+    if (mapping->getSize() >= sizeof(FileHeader)) {
+        header = static_cast<const FileHeader*>(mapping->getData());
+        entries = reinterpret_cast<const EntryHeader*>(header + 1);
+    }
+}
+
+bool PartitionedImpulseResponseFile::isValid() const noexcept
+{
+    if (header == nullptr || std::memcmp(header->magic, "VPIR", 4) != 0 || header->version != currentVersion)
+        return false;
+
+    if (header->numChannels == 0 || header->numChannels > 32 || header->sourceSampleRate <= 0.0)
+        return false;
+
+    auto entriesEnd = sizeof(FileHeader) + static_cast<juce::uint64>(header->numEntries) * sizeof(EntryHeader);
+
+    if (entriesEnd > mapping->getSize())
+        return false;
+
+    auto channelsFit = [this] (juce::uint64 offset, juce::uint64 numFloats)
+    {
+        return contains(offset, getChannelStride(numFloats, alignment) / sizeof(float) * (header->numChannels - 1) + numFloats);
+    };
+
+    if (! channelsFit(header->sourceOffset, header->sourceLength))
+        return false;
+
+    for (juce::uint32 index = 0; index < header->numEntries; ++index) {
+        const auto& entry = entries[index];
+
+        if (entry.numStages <= 0 || entry.numStages > maxStages || entry.numPartitionedStages < 0 || entry.numPartitionedStages > entry.numStages)
+            return false;
+
+        if (entry.headLength < 0 || entry.impulseResponseLength < 0 || entry.latency < 0 || entry.sampleRate <= 0.0)
+            return false;
+
+        if (entry.headLength > 0 && ! channelsFit(entry.headOffset, static_cast<juce::uint64>(entry.headLength)))
+            return false;
+
+        for (int stage = 0; stage < entry.numPartitionedStages; ++stage) {
+            const auto& stageHeader = entry.stages[stage];
+
+            if (stageHeader.blockSize <= 0 || ! juce::isPowerOfTwo(stageHeader.blockSize) || stageHeader.numPartitions <= 0 || stageHeader.skippedPartitions < 0)
+                return false;
+
+            auto numFloats = static_cast<juce::uint64>(stageHeader.numPartitions) * static_cast<juce::uint64>(PartitionedConvolver::Filter::getSpectrumSize(stageHeader.blockSize));
+
+            if (! channelsFit(stageHeader.dataOffset, numFloats))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+bool PartitionedImpulseResponseFile::contains(juce::uint64 offset, juce::uint64 numFloats) const noexcept
+{
+    return offset % alignment == 0 && offset <= mapping->getSize() && numFloats * sizeof(float) <= mapping->getSize() - offset;
+}
+
+const float* PartitionedImpulseResponseFile::getFloats(juce::uint64 offset) const noexcept
+{
+    return reinterpret_cast<const float*>(static_cast<const char*>(mapping->getData()) + offset);
+}
+
+bool PartitionedImpulseResponseFile::matchesLayout(const EntryHeader& entry, const PartitionedConvolver::Layout& layout) noexcept
+{
+    if (entry.latency != layout.latency || entry.numStages != static_cast<int>(layout.stages.size()))
+        return false;
+
+    for (int index = 0; index < entry.numStages; ++index) {
+        const auto& stage = layout.stages[static_cast<size_t>(index)];
+
+        if (entry.layoutStages[index][0] != stage.blockSize || entry.layoutStages[index][1] != stage.offset)
+            return false;
+    }
+
+    return true;
+}
+
+//==============================================================================
+std::shared_ptr<const PartitionedConvolver::Filter> PartitionedImpulseResponseFile::getFilter(double sampleRate, const PartitionedConvolver::Layout& layout) const
+{
+    for (juce::uint32 index = 0; index < header->numEntries; ++index) {
+        const auto& entry = entries[index];
+
+        //Stored as the layout that was chosen for the IR's length, see PartitionedConvolver::chooseLayout
+        auto layoutToUse = PartitionedConvolver::chooseLayout(layout, entry.impulseResponseLength);
+
+        if (! juce::approximatelyEqual(entry.sampleRate, sampleRate) || ! matchesLayout(entry, layoutToUse))
+            continue;
+
+        auto numChannels = static_cast<int>(header->numChannels);
+        std::vector<const float*> headTaps;
+
+        for (int channel = 0; channel < numChannels && entry.headLength > 0; ++channel)
+            headTaps.push_back(getFloats(entry.headOffset + static_cast<juce::uint64>(channel) * getChannelStride(static_cast<juce::uint64>(entry.headLength), alignment)));
+
+        std::vector<PartitionedConvolver::Filter::Partitions> partitions;
+
+        for (int stage = 0; stage < entry.numPartitionedStages; ++stage) {
+            const auto& stageHeader = entry.stages[stage];
+            auto numFloats = static_cast<juce::uint64>(stageHeader.numPartitions) * static_cast<juce::uint64>(PartitionedConvolver::Filter::getSpectrumSize(stageHeader.blockSize));
+
+            PartitionedConvolver::Filter::Partitions stagePartitions;
+            stagePartitions.blockSize = stageHeader.blockSize;
+            stagePartitions.numPartitions = stageHeader.numPartitions;
+            stagePartitions.skippedPartitions = stageHeader.skippedPartitions;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                stagePartitions.spectra.push_back(getFloats(stageHeader.dataOffset + static_cast<juce::uint64>(channel) * getChannelStride(numFloats, alignment)));
+
+            partitions.push_back(std::move(stagePartitions));
+        }
+
+        return std::make_shared<const PartitionedConvolver::Filter>(layoutToUse, entry.impulseResponseLength, entry.headLength, std::move(headTaps),
+                                                                    std::move(partitions), shared_from_this());
+    }
+
+    return nullptr;
+}
+
+juce::AudioBuffer<float> PartitionedImpulseResponseFile::getSourceImpulseResponse() const
+{
+    auto numChannels = static_cast<int>(header->numChannels);
+    auto length = static_cast<int>(header->sourceLength);
+    juce::AudioBuffer<float> impulseResponse(numChannels, length);
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        impulseResponse.copyFrom(channel, 0, getFloats(header->sourceOffset + static_cast<juce::uint64>(channel) * getChannelStride(header->sourceLength, alignment)), length);
+
+    return impulseResponse;
+}
+
+double PartitionedImpulseResponseFile::getSourceSampleRate() const noexcept
+{
+    return header->sourceSampleRate;
+}
+
+bool PartitionedImpulseResponseFile::isTrimmed() const noexcept
+{
+    return (header->flags & trimmed) != 0;
+}
+
+bool PartitionedImpulseResponseFile::isNormalised() const noexcept
+{
+    return (header->flags & normalised) != 0;
+}
+
+int PartitionedImpulseResponseFile::getNumEntries() const noexcept
+{
+    return static_cast<int>(header->numEntries);
+}
+
+//==============================================================================
+bool PartitionedImpulseResponseFile::write(const juce::File& file, const juce::AudioBuffer<float>& impulseResponse, double fileSampleRate,
+                                           const juce::Array<double>& sampleRates, const std::vector<PartitionedConvolver::Layout>& layouts,
+                                           bool trim, bool normalise)
+{
+    auto numChannels = impulseResponse.getNumChannels();
+
+    if (numChannels <= 0 || numChannels > 32 || impulseResponse.getNumSamples() == 0 || fileSampleRate <= 0.0)
+        return false;
+
+    struct Entry
+    {
+        double sampleRate;
+        std::unique_ptr<PartitionedConvolver::Filter> filter;
+    };
+
+    std::vector<Entry> filters;
+
+    for (auto sampleRate : sampleRates) {
+        auto prepared = PartitionedConvolver::prepareImpulseResponse(impulseResponse, fileSampleRate, sampleRate, trim, normalise);
+
+        for (const auto& layout : layouts) {
+            if (layout.stages.empty() || static_cast<int>(layout.stages.size()) > maxStages)
+                return false;
+
+            auto layoutToUse = PartitionedConvolver::chooseLayout(layout, prepared.getNumSamples());
+            filters.push_back({sampleRate, std::make_unique<PartitionedConvolver::Filter>(prepared, layoutToUse)});
+        }
+    }
+
+    //Everything is laid out first so the headers can point at it
+    FileHeader fileHeader {};
+    std::memcpy(fileHeader.magic, "VPIR", 4);
+    fileHeader.version = currentVersion;
+    fileHeader.numEntries = static_cast<juce::uint32>(filters.size());
+    fileHeader.numChannels = static_cast<juce::uint32>(numChannels);
+    fileHeader.sourceSampleRate = fileSampleRate;
+    fileHeader.sourceLength = static_cast<juce::uint32>(impulseResponse.getNumSamples());
+    fileHeader.flags = (trim ? trimmed : 0) | (normalise ? normalised : 0);
+
+    auto position = alignUp(sizeof(FileHeader) + filters.size() * sizeof(EntryHeader), alignment);
+
+    auto reserve = [&position, numChannels] (juce::uint64 numFloats)
+    {
+        auto offset = position;
+        position += getChannelStride(numFloats, alignment) * static_cast<juce::uint64>(numChannels);
+        return offset;
+    };
+
+    fileHeader.sourceOffset = reserve(fileHeader.sourceLength);
+
+    std::vector<EntryHeader> entryHeaders(filters.size());
+
+    for (size_t index = 0; index < filters.size(); ++index) {
+        const auto& filter = *filters[index].filter;
+        const auto& layout = filter.getLayout();
+        auto& entry = entryHeaders[index];
+
+        entry = {};
+        entry.sampleRate = filters[index].sampleRate;
+        entry.latency = layout.latency;
+        entry.numStages = static_cast<juce::int32>(layout.stages.size());
+        entry.numPartitionedStages = static_cast<juce::int32>(filter.getPartitions().size());
+        entry.impulseResponseLength = filter.getImpulseResponseLength();
+        entry.headLength = filter.getHeadTaps().empty() ? 0 : filter.getHeadLength();
+
+        for (size_t stage = 0; stage < layout.stages.size(); ++stage) {
+            entry.layoutStages[stage][0] = layout.stages[stage].blockSize;
+            entry.layoutStages[stage][1] = layout.stages[stage].offset;
+        }
+
+        if (entry.headLength > 0)
+            entry.headOffset = reserve(static_cast<juce::uint64>(entry.headLength));
+
+        for (size_t stage = 0; stage < filter.getPartitions().size(); ++stage) {
+            const auto& partitions = filter.getPartitions()[stage];
+            auto& stageHeader = entry.stages[stage];
+
+            stageHeader.blockSize = partitions.blockSize;
+            stageHeader.numPartitions = partitions.numPartitions;
+            stageHeader.skippedPartitions = partitions.skippedPartitions;
+            stageHeader.dataOffset = reserve(static_cast<juce::uint64>(partitions.numPartitions * PartitionedConvolver::Filter::getSpectrumSize(partitions.blockSize)));
+        }
+    }
+
+    juce::MemoryBlock data(static_cast<size_t>(position), true);
+    auto* bytes = static_cast<char*>(data.getData());
+
+    auto copyChannels = [bytes] (juce::uint64 offset, const std::vector<const float*>& channels, juce::uint64 numFloats)
+    {
+        for (size_t channel = 0; channel < channels.size(); ++channel)
+            std::memcpy(bytes + offset + channel * getChannelStride(numFloats, alignment), channels[channel], numFloats * sizeof(float));
+    };
+
+    std::memcpy(bytes, &fileHeader, sizeof(FileHeader));
+    std::memcpy(bytes + sizeof(FileHeader), entryHeaders.data(), entryHeaders.size() * sizeof(EntryHeader));
+
+    std::vector<const float*> sourceChannels;
+
+    for (int channel = 0; channel < numChannels; ++channel)
+        sourceChannels.push_back(impulseResponse.getReadPointer(channel));
+
+    copyChannels(fileHeader.sourceOffset, sourceChannels, fileHeader.sourceLength);
+
+    for (size_t index = 0; index < filters.size(); ++index) {
+        const auto& filter = *filters[index].filter;
+        const auto& entry = entryHeaders[index];
+
+        if (entry.headLength > 0)
+            copyChannels(entry.headOffset, filter.getHeadTaps(), static_cast<juce::uint64>(entry.headLength));
+
+        for (size_t stage = 0; stage < filter.getPartitions().size(); ++stage) {
+            const auto& partitions = filter.getPartitions()[stage];
+            auto numFloats = static_cast<juce::uint64>(partitions.numPartitions * PartitionedConvolver::Filter::getSpectrumSize(partitions.blockSize));
+            copyChannels(entry.stages[stage].dataOffset, partitions.spectra, numFloats);
+        }
+    }
+
+    //Written next to the target and moved over it, so a library being read never sees half a file
+    juce::TemporaryFile temporaryFile(file);
+
+    if (! temporaryFile.getFile().replaceWithData(data.getData(), data.getSize()))
+        return false;
+
+    return temporaryFile.overwriteTargetFileWithTemporary();
+}
@@ -0,0 +1,120 @@
+/*
+  ==============================================================================
+
+    PartitionedImpulseResponseFile.h
+
+    A .pir file holds an IR ready to convolve: already trimmed, resampled to a
+    set of sample rates and cut into the partition spectra of a set of layouts.
+    Opening one maps it into memory and the filters refer straight into the
+    mapping, so loading is a page fault rather than decode, resample and FFT.
+    The original samples are kept too, so a rate or layout that wasn't built
+    in still works the slow way.
+
+    Layout, all values in the byte order of the machine that built it,
+    every float array starting on a 64 byte boundary:
+
+      FileHeader                      magic "VPIR", version, entry count, ...
+      EntryHeader x numEntries        one per sample rate and layout
+      float data                      source samples, head taps, spectra
+
+    Build them with the IRConverter tool (Tools/IRConverter).
+
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "PartitionedConvolver.h"
+
+class PartitionedImpulseResponseFile : public std::enable_shared_from_this<PartitionedImpulseResponseFile>
+{
+public:
+    static constexpr const char* fileExtension = ".pir";
+
+    //Opens and maps a .pir file, null if it can't be mapped or isn't a valid one
+    static std::shared_ptr<PartitionedImpulseResponseFile> open(const juce::File& file);
+
+    //Conditions the IR the way prepareImpulseResponse does for every rate, partitions it for every
+    //layout and writes the lot, along with the original samples
+    static bool write(const juce::File& file, const juce::AudioBuffer<float>& impulseResponse, double fileSampleRate,
+                      const juce::Array<double>& sampleRates, const std::vector<PartitionedConvolver::Layout>& layouts,
+                      bool trim = true, bool normalise = true);
+
+    //The pre-partitioned filter for a rate and layout, referring into the mapping, or null
+    //if the file doesn't have it. Keeps the mapping alive for as long as it's used
+    std::shared_ptr<const PartitionedConvolver::Filter> getFilter(double sampleRate, const PartitionedConvolver::Layout& layout) const;
+
+    //The samples the file was built from, copied out of the mapping
+    juce::AudioBuffer<float> getSourceImpulseResponse() const;
+    double getSourceSampleRate() const noexcept;
+
+    bool isTrimmed() const noexcept;
+    bool isNormalised() const noexcept;
+
+    int getNumEntries() const noexcept;
+
+private:
+
+    static constexpr juce::uint32 currentVersion = 1;
+    static constexpr int maxStages = 8;
+    static constexpr size_t alignment = 64;
+
+    struct StageHeader
+    {
+        juce::int32 blockSize;
+        juce::int32 offset;
+        juce::int32 numPartitions;
+        juce::int32 skippedPartitions;
+        juce::uint64 dataOffset;
+    };
+
+    struct EntryHeader
+    {
+        double sampleRate;
+        juce::int32 latency;
+        juce::int32 numStages;
+        juce::int32 numPartitionedStages;
+        juce::int32 impulseResponseLength;
+        juce::int32 headLength;
+        juce::int32 reserved;
+        juce::uint64 headOffset;
+
+        //The layout's stages as given, then the ones that ended up with partitions
+        juce::int32 layoutStages[maxStages][2];
+        StageHeader stages[maxStages];
+    };
+
+    struct FileHeader
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::uint32 numEntries;
+        juce::uint32 numChannels;
+        double sourceSampleRate;
+        juce::uint32 sourceLength;
+        juce::uint32 flags;
+        juce::uint64 sourceOffset;
+        juce::uint8 reserved[24];
+    };
+
+    enum Flags
+    {
+        trimmed = 1,
+        normalised = 2
+    };
+
+    explicit PartitionedImpulseResponseFile(std::unique_ptr<juce::MemoryMappedFile> mappedFile);
+
+    bool isValid() const noexcept;
+    static bool matchesLayout(const EntryHeader& entry, const PartitionedConvolver::Layout& layout) noexcept;
+    const float* getFloats(juce::uint64 offset) const noexcept;
+    bool contains(juce::uint64 offset, juce::uint64 numFloats) const noexcept;
+
+    //Filters hold a shared pointer to this object, so the mapping outlives every one of them
+    std::unique_ptr<juce::MemoryMappedFile> mapping;
+    const FileHeader* header = nullptr;
+    const EntryHeader* entries = nullptr;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PartitionedImpulseResponseFile)
+};
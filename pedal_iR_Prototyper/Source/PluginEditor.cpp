@@ -58,6 +58,55 @@ Pedal_iR_PrototyperAudioProcessorEditor::Pedal_iR_PrototyperAudioProcessorEditor
     trimSlider.setDoubleClickReturnValue(true, 0.0);
     trimSliderAttach = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(audioProcessor.treeState, trimSliderId, trimSlider);
     
+    //IR, convolution latency/CPU preset, pre EQ, clipping and channel linking menus, item ids are the choice index + 1
+    addAndMakeVisible(impulseResponseMenu);
+    addAndMakeVisible(convolutionMenu);
+    addAndMakeVisible(preFilterMenu);
+    addAndMakeVisible(clippingMenu);
+    addAndMakeVisible(processingModeMenu);
+    
+    for (auto* menu : {&impulseResponseMenu, &convolutionMenu, &preFilterMenu, &clippingMenu, &processingModeMenu}) {
+        menu->setColour(0x1000a00, juce::Colour::fromFloatRGBA(1, 1, 1, 0.5f));
+        menu->setColour(0x1000b00, juce::Colour::fromFloatRGBA(0, 0, 0, 0.25f));
+        menu->setColour(0x1000c00, juce::Colour::fromFloatRGBA(0, 0, 0, 0));
+        menu->setColour(0x1000e00, juce::Colour::fromFloatRGBA(0.392f, 0.584f, 0.929f, 0.25f));
+    }
+    
+    impulseResponseMenu.addItemList({"Overdrive", "Pedal At 12", "High Gain Low Drive", "User File"}, 1);
+    impulseResponseMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, impulseResponseParamId, impulseResponseMenu);
+    
+    convolutionMenu.addItemList({"Auto", "Zero Latency", "Low Latency", "Balanced", "Throughput"}, 1);
+    convolutionMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, convolutionModeId, convolutionMenu);
+    
+    preFilterMenu.addItemList({"Off", "Mid Hump", "Tight", "Bright"}, 1);
+    preFilterMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, preFilterId, preFilterMenu);
+    
+    clippingMenu.addItemList({"Tanh", "Soft Clip", "Hard Clip", "DC Bias"}, 1);
+    clippingMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, clippingId, clippingMenu);
+    
+    processingModeMenu.addItemList({"Independent", "Linked"}, 1);
+    processingModeMenuAttach = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(audioProcessor.treeState, processingModeId, processingModeMenu);
+    
+    //Load a captured IR from disk, it's decoded and swapped in on a background thread
+    addAndMakeVisible(loadButton);
+    loadButton.setButtonText("Load IR");
+    loadButton.setColour(juce::TextButton::buttonColourId, juce::Colour::fromFloatRGBA(0, 0, 0, 0.25f));
+    loadButton.setColour(juce::TextButton::textColourOffId, juce::Colour::fromFloatRGBA(1, 1, 1, 0.5f));
+    loadButton.onClick = [this]
+    {
+        auto startingPoint = audioProcessor.getUserImpulseResponse();
+        fileChooser = std::make_unique<juce::FileChooser>("Load an impulse response", startingPoint, "*.wav;*.aif;*.aiff;*.flac;*.pir");
+        
+        fileChooser->launchAsync(juce::FileBrowserComponent::openMode | juce::FileBrowserComponent::canSelectFiles, [this] (const juce::FileChooser& chooser)
+        {
+            auto file = chooser.getResult();
+            
+            if (file.existsAsFile()) {
+                audioProcessor.loadUserImpulseResponse(file);
+            }
+        });
+    };
+    
     setSize (400, 300);
 }
 
@@ -88,6 +137,26 @@ void Pedal_iR_PrototyperAudioProcessorEditor::resized()
 {
     //Master bounds object
     juce::Rectangle<int> bounds = getLocalBounds();
+    
+    //IR, load and convolution mode along the bottom
+    juce::FlexBox flexboxMenus;
+    flexboxMenus.flexDirection = juce::FlexBox::Direction::row;
+    flexboxMenus.justifyContent = juce::FlexBox::JustifyContent::center;
+    flexboxMenus.alignItems = juce::FlexBox::AlignItems::center;
+    flexboxMenus.items.add(juce::FlexItem(bounds.getWidth() / 3.2, bounds.getHeight() / 12, impulseResponseMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxMenus.items.add(juce::FlexItem(bounds.getWidth() / 6.0, bounds.getHeight() / 12, loadButton).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxMenus.items.add(juce::FlexItem(bounds.getWidth() / 3.2, bounds.getHeight() / 12, convolutionMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxMenus.performLayout(bounds.removeFromBottom(bounds.getHeight() / 8));
+    
+    //Pre EQ, clipping and linking, the front half of the pedal model, just above
+    juce::FlexBox flexboxModel;
+    flexboxModel.flexDirection = juce::FlexBox::Direction::row;
+    flexboxModel.justifyContent = juce::FlexBox::JustifyContent::center;
+    flexboxModel.alignItems = juce::FlexBox::AlignItems::center;
+    flexboxModel.items.add(juce::FlexItem(bounds.getWidth() / 3.4, bounds.getHeight() / 10, preFilterMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxModel.items.add(juce::FlexItem(bounds.getWidth() / 3.4, bounds.getHeight() / 10, clippingMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxModel.items.add(juce::FlexItem(bounds.getWidth() / 3.4, bounds.getHeight() / 10, processingModeMenu).withMargin(juce::FlexItem::Margin(0, 2, 0, 2)));
+    flexboxModel.performLayout(bounds.removeFromBottom(bounds.getHeight() / 7));
                         
     //first column of gui
     juce::FlexBox flexboxColumnOne;
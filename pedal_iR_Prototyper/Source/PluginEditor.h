@@ -62,6 +62,12 @@ private:
                 
     std::unique_ptr <juce::AudioProcessorValueTreeState::SliderAttachment> inputSliderAttach, toneSliderAttach, trimSliderAttach;
     
+    juce::ComboBox convolutionMenu, impulseResponseMenu, preFilterMenu, clippingMenu, processingModeMenu;
+    std::unique_ptr <juce::AudioProcessorValueTreeState::ComboBoxAttachment> convolutionMenuAttach, impulseResponseMenuAttach, preFilterMenuAttach, clippingMenuAttach, processingModeMenuAttach;
+    
+    juce::TextButton loadButton;
+    std::unique_ptr<juce::FileChooser> fileChooser;
+    
     Pedal_iR_PrototyperAudioProcessor& audioProcessor;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Pedal_iR_PrototyperAudioProcessorEditor)
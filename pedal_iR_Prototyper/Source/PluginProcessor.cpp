@@ -8,6 +8,98 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "../../ViatorDSP/DistortionEngine.h"
+
+namespace
+{
+    //The IRs built into the plugin, in the order of the impulse response choices.
+    //The last choice is a user file
+    struct EmbeddedImpulseResponse
+    {
+        const char* data;
+        int dataSize;
+    };
+
+    const EmbeddedImpulseResponse embeddedImpulseResponses[] =
+    {
+        { BinaryData::pedalOverdrive_wav, BinaryData::pedalOverdrive_wavSize },
+        { BinaryData::pedalAt12_wav, BinaryData::pedalAt12_wavSize },
+        { BinaryData::highGainLowDrive_wav, BinaryData::highGainLowDrive_wavSize }
+    };
+
+    const int numEmbeddedImpulseResponses = static_cast<int>(sizeof(embeddedImpulseResponses) / sizeof(embeddedImpulseResponses[0]));
+
+    const juce::Identifier userImpulseResponseProperty {"userImpulseResponse"};
+    
+    //The pre EQ voicings, in the order of the pre EQ choices. Each is a short chain of
+    //biquads, all minimum phase, rendered to an impulse response at the processing rate
+    enum PreFilterVoicing
+    {
+        preFilterOff = 0,
+        preFilterMidHump,
+        preFilterTight,
+        preFilterBright,
+        numPreFilterVoicings
+    };
+    
+    juce::AudioBuffer<float> makePreFilterImpulseResponse(int voicing, double sampleRate)
+    {
+        using Coefficients = juce::dsp::IIR::Coefficients<float>;
+        std::vector<Coefficients::Ptr> sections;
+        
+        switch (voicing) {
+            case preFilterMidHump:
+                //Bass cut into the clipper and a hump around 1 kHz, the classic overdrive front end
+                sections = {Coefficients::makeHighPass(sampleRate, 500.0f, 0.5f),
+                            Coefficients::makePeakFilter(sampleRate, 1000.0f, 0.7f, 2.0f),
+                            Coefficients::makeLowPass(sampleRate, 6000.0f, 0.7f)};
+                break;
+            case preFilterTight:
+                sections = {Coefficients::makeHighPass(sampleRate, 250.0f, 0.7f),
+                            Coefficients::makeLowPass(sampleRate, 8000.0f, 0.7f)};
+                break;
+            case preFilterBright:
+                sections = {Coefficients::makeHighShelf(sampleRate, 2500.0f, 0.7f, 2.0f)};
+                break;
+            default:
+                return {};
+        }
+        
+        //Long enough for a 250 Hz high pass to ring out at 192 kHz, trimmed to -80 dB afterwards
+        auto length = juce::roundToInt(sampleRate * 0.01);
+        juce::AudioBuffer<float> impulseResponse(1, length);
+        impulseResponse.clear();
+        impulseResponse.setSample(0, 0, 1.0f);
+        
+        for (auto& section : sections) {
+            juce::dsp::IIR::Filter<float> filter(section);
+            auto* data = impulseResponse.getWritePointer(0);
+            
+            for (int sample = 0; sample < length; ++sample) {
+                data[sample] = filter.processSample(data[sample]);
+            }
+        }
+        
+        return PartitionedConvolver::prepareImpulseResponse(impulseResponse, sampleRate, sampleRate, true, false);
+    }
+    
+    //The clipping choices, the engine's curves at zero drive since the input knob is the drive here.
+    //Sampled in double, which takes the exact curves rather than the engine's own tables
+    template <typename Model>
+    double engineCurve(double x)
+    {
+        auto coefficients = Model::makeCoefficients(0.0f);
+        return Model::processSample(x, coefficients) * coefficients.outputGain;
+    }
+    
+    const std::function<double(double)> clippingCurves[] =
+    {
+        engineCurve<ViatorDSP::DistortionEngine::Tanh>,
+        engineCurve<ViatorDSP::DistortionEngine::SoftClip>,
+        engineCurve<ViatorDSP::DistortionEngine::HardClip>,
+        engineCurve<ViatorDSP::DistortionEngine::DCDistortion>
+    };
+}
 
 //==============================================================================
 Pedal_iR_PrototyperAudioProcessor::Pedal_iR_PrototyperAudioProcessor()
@@ -20,13 +112,21 @@ Pedal_iR_PrototyperAudioProcessor::Pedal_iR_PrototyperAudioProcessor()
                        .withOutput ("Output", juce::AudioChannelSet::stereo(), true)
                      #endif
                        ),
-treeState (*this, nullptr, "PARAMETER", createParameterLayout()),
-toneFilter(juce::dsp::IIR::Coefficients<float>::makeHighShelf(lastSampleRate, 2020.0, 0.47, 0.0))
+treeState (*this, nullptr, "PARAMETER", createParameterLayout())
 #endif
 {
     treeState.addParameterListener (inputSliderId, this);
     treeState.addParameterListener (toneSliderId, this);
     treeState.addParameterListener (trimSliderId, this);
+    treeState.addParameterListener (convolutionModeId, this);
+    treeState.addParameterListener (impulseResponseParamId, this);
+    
+    //Only the first instance in the process actually decodes anything
+    for (const auto& embedded : embeddedImpulseResponses) {
+        impulseResponseLoader.preload({embedded.data, static_cast<size_t>(embedded.dataSize), {}});
+    }
+    
+    meterLogger = ViatorDSP::ProcessorMeterLogger::createFromEnvironment(meter, getName());
 }
 
 Pedal_iR_PrototyperAudioProcessor::~Pedal_iR_PrototyperAudioProcessor()
@@ -34,6 +134,9 @@ Pedal_iR_PrototyperAudioProcessor::~Pedal_iR_PrototyperAudioProcessor()
     treeState.removeParameterListener (inputSliderId, this);
     treeState.removeParameterListener (toneSliderId, this);
     treeState.removeParameterListener (trimSliderId, this);
+    treeState.removeParameterListener (convolutionModeId, this);
+    treeState.removeParameterListener (impulseResponseParamId, this);
+    cancelPendingUpdate();
 }
 
 //==============================================================================
@@ -71,7 +174,7 @@ bool Pedal_iR_PrototyperAudioProcessor::isMidiEffect() const
 
 double Pedal_iR_PrototyperAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    return getSampleRate() > 0.0 ? impulseResponseLength.load() / getSampleRate() : 0.0;
 }
 
 int Pedal_iR_PrototyperAudioProcessor::getNumPrograms()
@@ -101,43 +204,98 @@ void Pedal_iR_PrototyperAudioProcessor::changeProgramName (int index, const juce
 //==============================================================================
 void Pedal_iR_PrototyperAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 {
+    meter.prepare(sampleRate);
+    
     juce::dsp::ProcessSpec spec;
     spec.maximumBlockSize = samplesPerBlock;
     spec.sampleRate = sampleRate;
     spec.numChannels = getTotalNumOutputChannels();
     
-    inputProcessor.prepare(spec);
-    inputProcessor.reset();
-    inputProcessor.setGainDecibels(*treeState.getRawParameterValue(inputSliderId));
+    inputGainDecibels.store(treeState.getRawParameterValue(inputSliderId)->load());
+    inputGain.reset(sampleRate, gainRampSeconds);
+    inputGain.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(inputGainDecibels.load()));
+    
+    trimGainDecibels.store(treeState.getRawParameterValue(trimSliderId)->load());
+    trimGain.reset(sampleRate, gainRampSeconds);
+    trimGain.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(trimGainDecibels.load()));
+    
+    gainRamp.setSize(1, samplesPerBlock);
+    linkBuffer.setSize(2, samplesPerBlock);
+    
+    if (! tanhTable.isBuilt()) {
+        tanhTable.build([] (double x) { return std::tanh(x); }, -8.0f, 8.0f);
+        
+        //Wider, the input gain and the pre EQ both come before the clipping
+        for (int curve = 0; curve < numClippingCurves; ++curve) {
+            clippingTables[static_cast<size_t>(curve)].build(clippingCurves[curve], -16.0f, 16.0f);
+        }
+    }
+    
+    //Every voicing is built here, so the audio thread only ever switches between them
+    preFilters.clear();
+    
+    for (int voicing = 0; voicing < numPreFilterVoicings; ++voicing) {
+        auto impulseResponse = makePreFilterImpulseResponse(voicing, sampleRate);
+        
+        if (impulseResponse.getNumSamples() == 0) {
+            preFilters.push_back(nullptr);
+            continue;
+        }
+        
+        auto layout = PartitionedConvolver::getPresetLayout(PartitionedConvolver::zeroLatency);
+        preFilters.push_back(std::make_unique<PartitionedConvolver>(impulseResponse, layout, samplesPerBlock, static_cast<int>(spec.numChannels)));
+    }
     
-    convolutionProcessor.prepare(spec);
-    convolutionProcessor.reset();
+    preFilterTail = 0;
     
-    trimProcessor.prepare(spec);
-    trimProcessor.reset();
-    trimProcessor.setGainDecibels(*treeState.getRawParameterValue(trimSliderId));
+    for (auto& preFilter : preFilters) {
+        if (preFilter != nullptr) {
+            preFilterTail = juce::jmax(preFilterTail, preFilter->getLatencySamples() + preFilter->getImpulseResponseLength());
+        }
+    }
+    
+    preFilterIndex = static_cast<int>(treeState.getRawParameterValue(preFilterId)->load());
+    fadingPreFilterIndex = -1;
+    preFilterCrossfade.reset(sampleRate, crossfadeSeconds);
+    preFilterCrossfade.setCurrentAndTargetValue(1.0f);
             
-    convolutionProcessor.loadImpulseResponse
-        (BinaryData::pedalOverdrive_wav,
-         BinaryData::pedalOverdrive_wavSize,
-         juce::dsp::Convolution::Stereo::yes,
-         juce::dsp::Convolution::Trim::yes, 0,
-         juce::dsp::Convolution::Normalise::yes);
+    //The audio thread isn't running yet, so this one can be built here and go straight in
+    preparedBlockSize = samplesPerBlock;
+    fadingConvolver.reset();
     
-    toneFilter.prepare(spec);
-    toneFilter.reset();
+    auto numGroups = (static_cast<int>(spec.numChannels) + channelsPerGroup - 1) / channelsPerGroup;
+    convolutionWorkers.prepare(numGroups, [this] (int group) { convolveGroup(group); });
+    convolver = impulseResponseLoader.loadNow(createConvolverRequest(sampleRate, samplesPerBlock));
     
-    updateToneFilter(*treeState.getRawParameterValue(toneSliderId));
+    //A user file that's gone missing falls back to the first built in IR
+    if (convolver == nullptr) {
+        auto request = createConvolverRequest(sampleRate, samplesPerBlock);
+        request.source = {embeddedImpulseResponses[0].data, static_cast<size_t>(embeddedImpulseResponses[0].dataSize), {}};
+        convolver = impulseResponseLoader.loadNow(request);
+    }
+    
+    convolverLatency.store(convolver->getLatencySamples());
+    impulseResponseLength.store(convolver->getImpulseResponseLength());
+    setLatencySamples(convolver->getLatencySamples());
     
-    firstAtan.prepare(spec);
-    firstAtan.reset();
+    fadingBuffer.setSize(static_cast<int>(spec.numChannels), samplesPerBlock);
+    crossfadeGains.setSize(1, samplesPerBlock);
+    crossfade.reset(sampleRate, crossfadeSeconds);
+    crossfade.setCurrentAndTargetValue(1.0f);
     
-    firstAtan.functionToUse = juce::dsp::FastMathApproximations::tanh;
+    //Everything about the shelf but its gain is fixed for the sample rate
+    lastSampleRate = sampleRate;
+    auto omega = juce::MathConstants<double>::twoPi * toneFrequency / sampleRate;
+    toneCos = std::cos(omega);
+    toneSin = std::sin(omega);
     
-    secondAtan.prepare(spec);
-    secondAtan.reset();
+    toneState.assign(spec.numChannels, {0.0f, 0.0f});
+    silenceDetector.reset();
     
-    secondAtan.functionToUse = juce::dsp::FastMathApproximations::tanh;
+    updateToneFilter(*treeState.getRawParameterValue(toneSliderId));
+    toneGain.reset(sampleRate, toneRampSeconds);
+    toneGain.setCurrentAndTargetValue(toneGainDecibels.load());
+    updateToneCoefficients(toneGain.getCurrentValue());
 }
 
 void Pedal_iR_PrototyperAudioProcessor::releaseResources()
@@ -153,12 +311,11 @@ bool Pedal_iR_PrototyperAudioProcessor::isBusesLayoutSupported (const BusesLayou
     juce::ignoreUnused (layouts);
     return true;
   #else
-    // This is the place where you check if the layout is supported.
-    // In this template code we only support mono or stereo.
-    // Some plugin hosts, such as certain GarageBand versions, will only
-    // load plugins that support stereo bus layouts.
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-     && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    //Every channel runs the same chain, so any layout works, mono and stereo through
+    //surround and immersive beds to ambisonics
+    auto channelSet = layouts.getMainOutputChannelSet();
+    
+    if (channelSet.isDisabled() || channelSet.size() > maxBusChannels)
         return false;
 
     // This checks if the input layout matches the output layout
@@ -175,40 +332,472 @@ bool Pedal_iR_PrototyperAudioProcessor::isBusesLayoutSupported (const BusesLayou
 void Pedal_iR_PrototyperAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
+    ViatorDSP::ProcessorMeter::ScopedBlock meterBlock(meter, buffer.getNumSamples());
     //auto totalNumInputChannels  = getTotalNumInputChannels();
     //auto totalNumOutputChannels = getTotalNumOutputChannels();
+    
+    //Ahead of the silence check so skipped blocks ramp towards the same targets
+    inputGain.setTargetValue(juce::Decibels::decibelsToGain(inputGainDecibels.load()));
+    trimGain.setTargetValue(juce::Decibels::decibelsToGain(trimGainDecibels.load()));
 
+    //Nothing can be skipped until whatever came in last has been through the pre EQ and the
+    //whole IR, latency included, of both convolvers while they're crossfading
+    auto convolverTail = convolver->getLatencySamples() + convolver->getImpulseResponseLength();
+    
+    if (fadingConvolver != nullptr) {
+        convolverTail = juce::jmax(convolverTail, fadingConvolver->getLatencySamples() + fadingConvolver->getImpulseResponseLength());
+    }
+    
+    silenceDetector.setMinimumSilence(preFilterTail + convolverTail);
+    
+    auto clipping = static_cast<int>(treeState.getRawParameterValue(clippingId)->load());
+    
+    if (clipping != lastClipping) {
+        lastClipping = clipping;
+        silenceDetector.settingsChanged();
+    }
+    
+    if (silenceDetector.beginBlock(buffer, buffer.getNumChannels())) {
+        skipSilentBlock(buffer.getNumSamples());
+        buffer.clear();
+        return;
+    }
+    
     juce::dsp::AudioBlock<float> audioBlock {buffer};
     
-    inputProcessor.process(juce::dsp::ProcessContextReplacing<float> (audioBlock));
+    //Linear, so it goes ahead of the input gain and the gain can share a pass with the clipping
+    processPreFilter(audioBlock);
     
-    firstAtan.process(juce::dsp::ProcessContextReplacing<float> (audioBlock));
+    processInputStage(audioBlock);
     
-    convolutionProcessor.process(juce::dsp::ProcessContextReplacing<float> (audioBlock));
+    //Take over a convolver built for a new IR or mode and fade over to it
+    if (fadingConvolver == nullptr) {
+        if (auto* nextConvolver = impulseResponseLoader.takeNextConvolver()) {
+            fadingConvolver = std::move(convolver);
+            convolver.reset(nextConvolver);
+            isLatencyFade = convolver->getLatencySamples() != fadingConvolver->getLatencySamples();
+            crossfade.setCurrentAndTargetValue(0.0f);
+            crossfade.setTargetValue(1.0f);
+            publishConvolver();
+        }
+    }
     
-    toneFilter.process(juce::dsp::ProcessContextReplacing<float>(audioBlock));
+    processConvolution(audioBlock);
     
-    trimProcessor.process(juce::dsp::ProcessContextReplacing<float> (audioBlock));
+    processOutputStage(audioBlock);
     
-//    for (int channel = 0; channel < totalNumInputChannels; ++channel)
-//    {
-//        auto* inputData = buffer.getReadPointer (channel);
-//        auto* outputData = buffer.getWritePointer (channel);
-//
-//        for (int sample = 0; sample < buffer.getNumSamples(); sample++) {
-//
-//            outputData[sample] = (-18 * pow(inputData[sample], 3)) + (23 * pow(inputData[sample], 2)) - (5 * inputData[sample]);
-//
-//        }
-//    }
+    silenceDetector.endBlock(buffer, buffer.getNumChannels());
+}
+
+void Pedal_iR_PrototyperAudioProcessor::skipSilentBlock(int numSamples) noexcept
+{
+    //Nothing is playing, so fades finish at once and a new convolver goes straight in
+    if (fadingConvolver != nullptr) {
+        impulseResponseLoader.retireConvolver(fadingConvolver.release());
+    }
     
+    if (auto* nextConvolver = impulseResponseLoader.takeNextConvolver()) {
+        impulseResponseLoader.retireConvolver(convolver.release());
+        convolver.reset(nextConvolver);
+        publishConvolver();
+    }
     
-   //secondAtan.process(juce::dsp::ProcessContextReplacing<float> (audioBlock));
+    crossfade.setCurrentAndTargetValue(1.0f);
+    fadingPreFilterIndex = -1;
+    preFilterCrossfade.setCurrentAndTargetValue(1.0f);
+    
+    inputGain.skip(numSamples);
+    trimGain.skip(numSamples);
+    toneGain.setTargetValue(toneGainDecibels.load());
+    
+    if (toneGain.isSmoothing()) {
+        updateToneCoefficients(toneGain.skip(numSamples));
+    }
+    
+    //What's left in the filters is below the silence threshold, empty them so the next
+    //sound starts from nothing
+    if (silenceDetector.hasStartedSkipping()) {
+        convolver->reset();
+        
+        for (auto& preFilter : preFilters) {
+            if (preFilter != nullptr) {
+                preFilter->reset();
+            }
+        }
+        
+        std::fill(toneState.begin(), toneState.end(), std::array<float, 2> {0.0f, 0.0f});
+    }
 }
 
-void Pedal_iR_PrototyperAudioProcessor::updateToneFilter(const float &gain){
-    *toneFilter.state = *juce::dsp::IIR::Coefficients<float>::makeHighShelf(lastSampleRate, 2020.0, 0.47, pow(10, gain / 20));
+PartitionedConvolver::Preset Pedal_iR_PrototyperAudioProcessor::getConvolutionPreset() const
+{
+    auto mode = static_cast<int>(treeState.getRawParameterValue(convolutionModeId)->load());
+    
+    if (mode == 0) {
+        return isNonRealtime() ? PartitionedConvolver::throughput : PartitionedConvolver::zeroLatency;
+    }
+    
+    return static_cast<PartitionedConvolver::Preset>(juce::jlimit(0, 3, mode - 1));
+}
+
+ImpulseResponseLoader::Request Pedal_iR_PrototyperAudioProcessor::createConvolverRequest(double sampleRate, int maximumBlockSize) const
+{
+    ImpulseResponseLoader::Request request;
+    request.layout = PartitionedConvolver::getPresetLayout(getConvolutionPreset());
+    request.sampleRate = sampleRate;
+    request.maximumBlockSize = maximumBlockSize;
+    request.numChannels = getTotalNumOutputChannels();
+    request.channelsPerGroup = channelsPerGroup;
+    
+    auto choice = static_cast<int>(treeState.getRawParameterValue(impulseResponseParamId)->load());
+    auto userFile = getUserImpulseResponse();
+    
+    if (choice >= numEmbeddedImpulseResponses && userFile.existsAsFile()) {
+        request.source.file = userFile;
+    } else {
+        const auto& embedded = embeddedImpulseResponses[juce::jlimit(0, numEmbeddedImpulseResponses - 1, choice)];
+        request.source.data = embedded.data;
+        request.source.dataSize = static_cast<size_t>(embedded.dataSize);
+    }
+    
+    return request;
+}
+
+void Pedal_iR_PrototyperAudioProcessor::processConvolution(juce::dsp::AudioBlock<float>& block) noexcept
+{
+    auto numSamples = block.getNumSamples();
+    auto chunkSize = static_cast<size_t>(juce::jmax(1, fadingBuffer.getNumSamples()));
+    
+    for (size_t startSample = 0; startSample < numSamples; startSample += chunkSize) {
+        auto numToProcess = juce::jmin(chunkSize, numSamples - startSample);
+        auto shareWork = convolutionWorkers.canShare(static_cast<int>(numToProcess), isNonRealtime());
+        convolutionBlock = block.getSubBlock(startSample, numToProcess);
+        
+        if (fadingConvolver == nullptr) {
+            convolutionWorkers.run(convolver->getNumGroups(), shareWork);
+            continue;
+        }
+        
+        //The outgoing convolver runs on a copy of the input, then the two are blended
+        auto numChannels = juce::jmin(convolutionBlock.getNumChannels(), static_cast<size_t>(fadingBuffer.getNumChannels()));
+        fadingConvolutionBlock = juce::dsp::AudioBlock<float>(fadingBuffer.getArrayOfWritePointers(), numChannels, numToProcess);
+        fadingConvolutionBlock.copyFrom(convolutionBlock);
+        
+        auto* gains = crossfadeGains.getWritePointer(0);
+        
+        for (size_t sample = 0; sample < numToProcess; ++sample) {
+            gains[sample] = crossfade.getNextValue();
+        }
+        
+        convolutionWorkers.run(convolver->getNumGroups(), shareWork);
+        
+        //Faded over, the old one goes back to the loader thread to be freed
+        if (! crossfade.isSmoothing()) {
+            impulseResponseLoader.retireConvolver(fadingConvolver.release());
+        }
+    }
+}
+
+void Pedal_iR_PrototyperAudioProcessor::convolveGroup(int group) noexcept
+{
+    convolver->processGroup(group, convolutionBlock);
+    
+    if (fadingConvolver == nullptr) {
+        return;
+    }
+    
+    fadingConvolver->processGroup(group, fadingConvolutionBlock);
+    
+    auto numSamples = fadingConvolutionBlock.getNumSamples();
+    auto firstChannel = static_cast<size_t>(group * channelsPerGroup);
+    auto endChannel = juce::jmin(firstChannel + channelsPerGroup, fadingConvolutionBlock.getNumChannels());
+    auto* gains = crossfadeGains.getReadPointer(0);
+    
+    for (size_t channel = firstChannel; channel < endChannel; ++channel) {
+        auto* newData = convolutionBlock.getChannelPointer(channel);
+        auto* oldData = fadingConvolutionBlock.getChannelPointer(channel);
+        
+        if (isLatencyFade) {
+            for (size_t sample = 0; sample < numSamples; ++sample) {
+                newData[sample] = juce::jmax(0.0f, 2.0f * gains[sample] - 1.0f) * newData[sample]
+                                + juce::jmax(0.0f, 1.0f - 2.0f * gains[sample]) * oldData[sample];
+            }
+        } else {
+            for (size_t sample = 0; sample < numSamples; ++sample) {
+                newData[sample] = oldData[sample] + gains[sample] * (newData[sample] - oldData[sample]);
+            }
+        }
+    }
+}
+
+void Pedal_iR_PrototyperAudioProcessor::publishConvolver() noexcept
+{
+    impulseResponseLength.store(convolver->getImpulseResponseLength());
+    
+    auto latency = convolver->getLatencySamples();
+    
+    if (convolverLatency.exchange(latency) != latency) {
+        latencyChanged.store(true);
+        triggerAsyncUpdate();
+    }
+}
+
+void Pedal_iR_PrototyperAudioProcessor::processPreFilter(juce::dsp::AudioBlock<float>& block) noexcept
+{
+    auto voicing = juce::jlimit(0, static_cast<int>(preFilters.size()) - 1, static_cast<int>(treeState.getRawParameterValue(preFilterId)->load()));
+    
+    //Start fading to a new voicing, its filter starts out empty
+    if (voicing != preFilterIndex && fadingPreFilterIndex < 0) {
+        fadingPreFilterIndex = preFilterIndex;
+        preFilterIndex = voicing;
+        
+        if (preFilters[static_cast<size_t>(preFilterIndex)] != nullptr) {
+            preFilters[static_cast<size_t>(preFilterIndex)]->reset();
+        }
+        
+        preFilterCrossfade.setCurrentAndTargetValue(0.0f);
+        preFilterCrossfade.setTargetValue(1.0f);
+    }
+    
+    auto* preFilter = preFilters[static_cast<size_t>(preFilterIndex)].get();
+    
+    if (fadingPreFilterIndex < 0) {
+        if (preFilter != nullptr) {
+            preFilter->process(block);
+        }
+        
+        return;
+    }
+    
+    auto* fadingPreFilter = preFilters[static_cast<size_t>(fadingPreFilterIndex)].get();
+    auto numSamples = block.getNumSamples();
+    auto chunkSize = static_cast<size_t>(juce::jmax(1, fadingBuffer.getNumSamples()));
+    
+    for (size_t startSample = 0; startSample < numSamples; startSample += chunkSize) {
+        auto numToProcess = juce::jmin(chunkSize, numSamples - startSample);
+        auto subBlock = block.getSubBlock(startSample, numToProcess);
+        
+        //Faded over part way through the block
+        if (fadingPreFilterIndex < 0) {
+            if (preFilter != nullptr) {
+                preFilter->process(subBlock);
+            }
+            
+            continue;
+        }
+        
+        auto numChannels = juce::jmin(subBlock.getNumChannels(), static_cast<size_t>(fadingBuffer.getNumChannels()));
+        
+        //Same as the convolver swap, the outgoing voicing runs on a copy and the two are blended
+        juce::dsp::AudioBlock<float> fadingBlock (fadingBuffer.getArrayOfWritePointers(), numChannels, numToProcess);
+        fadingBlock.copyFrom(subBlock);
+        
+        if (preFilter != nullptr) {
+            preFilter->process(subBlock);
+        }
+        
+        if (fadingPreFilter != nullptr) {
+            fadingPreFilter->process(fadingBlock);
+        }
+        
+        auto* gains = crossfadeGains.getWritePointer(0);
+        
+        for (size_t sample = 0; sample < numToProcess; ++sample) {
+            gains[sample] = preFilterCrossfade.getNextValue();
+        }
+        
+        for (size_t channel = 0; channel < numChannels; ++channel) {
+            auto* newData = subBlock.getChannelPointer(channel);
+            auto* oldData = fadingBlock.getChannelPointer(channel);
+            
+            for (size_t sample = 0; sample < numToProcess; ++sample) {
+                newData[sample] = oldData[sample] + gains[sample] * (newData[sample] - oldData[sample]);
+            }
+        }
+        
+        if (! preFilterCrossfade.isSmoothing()) {
+            fadingPreFilterIndex = -1;
+        }
+    }
+}
+
+void Pedal_iR_PrototyperAudioProcessor::processInputStage(juce::dsp::AudioBlock<float>& block) noexcept
+{
+    auto clipping = juce::jlimit(0, numClippingCurves - 1, static_cast<int>(treeState.getRawParameterValue(clippingId)->load()));
+    auto isLinked = block.getNumChannels() > 1 && static_cast<int>(treeState.getRawParameterValue(processingModeId)->load()) == linkedMode;
+    
+    //Linked gains are clipped / key, a curve with an offset at zero (DC Bias) would spread the offset
+    //over every channel as noise wherever the input is quiet, so it clips each channel on its own
+    if (std::abs(clippingTables[static_cast<size_t>(clipping)].processSample(0.0f)) > 1.0e-6f) {
+        isLinked = false;
+    }
+    auto numSamples = block.getNumSamples();
+    auto chunkSize = static_cast<size_t>(juce::jmax(1, gainRamp.getNumSamples()));
+    
+    for (size_t startSample = 0; startSample < numSamples; startSample += chunkSize) {
+        auto numToProcess = juce::jmin(chunkSize, numSamples - startSample);
+        auto subBlock = block.getSubBlock(startSample, numToProcess);
+        
+        //A ramp is worked out once and read by every channel, otherwise the gain is a constant
+        const auto& clippingTable = clippingTables[static_cast<size_t>(clipping)];
+        auto* ramp = gainRamp.getWritePointer(0);
+        auto isRamping = inputGain.isSmoothing();
+        auto gain = inputGain.getTargetValue();
+        
+        if (isRamping) {
+            for (size_t sample = 0; sample < numToProcess; ++sample) {
+                ramp[sample] = inputGain.getNextValue();
+            }
+        }
+        
+        if (! isLinked) {
+            for (size_t channel = 0; channel < subBlock.getNumChannels(); ++channel) {
+                auto* data = subBlock.getChannelPointer(channel);
+                
+                for (size_t sample = 0; sample < numToProcess; ++sample) {
+                    data[sample] = clippingTable.processSample(data[sample] * (isRamping ? ramp[sample] : gain));
+                }
+            }
+            
+            continue;
+        }
+        
+        //Linked: the loudest channel at each sample goes through the curve and every channel
+        //takes the same gain it came out with, so the image doesn't shift as it clips
+        auto* key = linkBuffer.getWritePointer(0);
+        auto* linkGain = linkBuffer.getWritePointer(1);
+        juce::FloatVectorOperations::copy(key, subBlock.getChannelPointer(0), static_cast<int>(numToProcess));
+        
+        for (size_t channel = 1; channel < subBlock.getNumChannels(); ++channel) {
+            auto* data = subBlock.getChannelPointer(channel);
+            
+            for (size_t sample = 0; sample < numToProcess; ++sample) {
+                key[sample] = std::abs(data[sample]) > std::abs(key[sample]) ? data[sample] : key[sample];
+            }
+        }
+        
+        //Every channel is no louder than the key, so the output never goes past the curve's
+        for (size_t sample = 0; sample < numToProcess; ++sample) {
+            auto clipped = clippingTable.processSample(key[sample] * (isRamping ? ramp[sample] : gain));
+            linkGain[sample] = key[sample] != 0.0f ? clipped / key[sample] : 0.0f;
+        }
+        
+        for (size_t channel = 0; channel < subBlock.getNumChannels(); ++channel) {
+            juce::FloatVectorOperations::multiply(subBlock.getChannelPointer(channel), linkGain, static_cast<int>(numToProcess));
+        }
+    }
+}
+
+void Pedal_iR_PrototyperAudioProcessor::processOutputStage(juce::dsp::AudioBlock<float>& block) noexcept
+{
+    auto numSamples = block.getNumSamples();
+    auto numChannels = juce::jmin(block.getNumChannels(), toneState.size());
+    auto chunkSize = static_cast<size_t>(juce::jmax(1, gainRamp.getNumSamples()));
+    
+    toneGain.setTargetValue(toneGainDecibels.load());
+    
+    for (size_t startSample = 0; startSample < numSamples; startSample += chunkSize) {
+        auto numToProcess = juce::jmin(chunkSize, numSamples - startSample);
+        auto subBlock = block.getSubBlock(startSample, numToProcess);
+        
+        auto* ramp = gainRamp.getWritePointer(0);
+        auto isRamping = trimGain.isSmoothing();
+        auto gain = trimGain.getTargetValue();
+        
+        if (isRamping) {
+            for (size_t sample = 0; sample < numToProcess; ++sample) {
+                ramp[sample] = trimGain.getNextValue();
+            }
+        }
+        
+        //Steady coefficients cover the whole chunk, a gliding shelf gets new ones every few samples
+        for (size_t spanStart = 0; spanStart < numToProcess;) {
+            auto spanLength = numToProcess - spanStart;
+            
+            if (toneGain.isSmoothing()) {
+                spanLength = juce::jmin(spanLength, toneUpdateInterval);
+                updateToneCoefficients(toneGain.skip(static_cast<int>(spanLength)));
+            }
+            
+            const auto b0 = static_cast<float>(toneCoefficients[0]);
+            const auto b1 = static_cast<float>(toneCoefficients[1]);
+            const auto b2 = static_cast<float>(toneCoefficients[2]);
+            const auto a1 = static_cast<float>(toneCoefficients[3]);
+            const auto a2 = static_cast<float>(toneCoefficients[4]);
+            
+            for (size_t channel = 0; channel < numChannels; ++channel) {
+                auto* data = subBlock.getChannelPointer(channel);
+                auto s1 = toneState[channel][0];
+                auto s2 = toneState[channel][1];
+                
+                for (size_t sample = spanStart; sample < spanStart + spanLength; ++sample) {
+                    auto input = data[sample];
+                    auto toned = b0 * input + s1;
+                    s1 = b1 * input - a1 * toned + s2;
+                    s2 = b2 * input - a2 * toned;
+                    
+                    data[sample] = tanhTable.processSample(toned) * (isRamping ? ramp[sample] : gain);
+                }
+                
+                toneState[channel] = {s1, s2};
+            }
+            
+            spanStart += spanLength;
+        }
+    }
+}
 
+void Pedal_iR_PrototyperAudioProcessor::updateToneCoefficients(float gainDecibels) noexcept
+{
+    //The same high shelf IIR::Coefficients::makeHighShelf gives, with A = 10^(dB / 40)
+    auto A = std::pow(10.0, gainDecibels / 40.0);
+    auto aMinus1 = A - 1.0;
+    auto aPlus1 = A + 1.0;
+    auto beta = toneSin * std::sqrt(A) / toneQ;
+    auto aMinus1TimesCos = aMinus1 * toneCos;
+    
+    auto a0 = aPlus1 - aMinus1TimesCos + beta;
+    
+    toneCoefficients[0] = A * (aPlus1 + aMinus1TimesCos + beta) / a0;
+    toneCoefficients[1] = A * -2.0 * (aMinus1 + aPlus1 * toneCos) / a0;
+    toneCoefficients[2] = A * (aPlus1 + aMinus1TimesCos - beta) / a0;
+    toneCoefficients[3] = 2.0 * (aMinus1 - aPlus1 * toneCos) / a0;
+    toneCoefficients[4] = (aPlus1 - aMinus1TimesCos - beta) / a0;
+}
+
+void Pedal_iR_PrototyperAudioProcessor::handleAsyncUpdate()
+{
+    //Only once prepared, prepareToPlay builds its own
+    if (convolverRequested.exchange(false) && preparedBlockSize > 0) {
+        impulseResponseLoader.loadAsync(createConvolverRequest(getSampleRate(), preparedBlockSize));
+    }
+    
+    //The host restarts playback for the new latency, which lands in prepareToPlay
+    if (latencyChanged.exchange(false)) {
+        setLatencySamples(convolverLatency.load());
+    }
+}
+
+void Pedal_iR_PrototyperAudioProcessor::loadUserImpulseResponse(const juce::File& file)
+{
+    treeState.state.setProperty(userImpulseResponseProperty, file.getFullPathName(), nullptr);
+    
+    auto* choice = treeState.getParameter(impulseResponseParamId);
+    choice->setValueNotifyingHost(choice->convertTo0to1(static_cast<float>(numEmbeddedImpulseResponses)));
+    
+    //Already on the user file, so the parameter didn't change
+    convolverRequested.store(true);
+    triggerAsyncUpdate();
+}
+
+juce::File Pedal_iR_PrototyperAudioProcessor::getUserImpulseResponse() const
+{
+    auto path = treeState.state.getProperty(userImpulseResponseProperty).toString();
+    return juce::File::isAbsolutePath(path) ? juce::File(path) : juce::File();
+}
+
+void Pedal_iR_PrototyperAudioProcessor::updateToneFilter(const float &gain){
+    toneGainDecibels.store(gain);
 }
 
 //==============================================================================
@@ -236,6 +825,10 @@ void Pedal_iR_PrototyperAudioProcessor::setStateInformation (const void* data, i
         if (tree.isValid())
         {
             treeState.state = tree;
+            
+            //The user file path isn't a parameter, so nothing else notices it changed
+            convolverRequested.store(true);
+            triggerAsyncUpdate();
         }
 }
 
@@ -243,24 +836,40 @@ void Pedal_iR_PrototyperAudioProcessor::parameterChanged(const juce::String &par
     if (parameterID == toneSliderId){
         updateToneFilter(newValue);
     } else if (parameterID == inputSliderId){
-        inputProcessor.setGainDecibels(newValue);
+        inputGainDecibels.store(newValue);
+    } else if (parameterID == convolutionModeId || parameterID == impulseResponseParamId){
+        //Passed on from the message thread to the loader thread, this can be called on the audio thread
+        convolverRequested.store(true);
+        triggerAsyncUpdate();
     } else {
-        trimProcessor.setGainDecibels(newValue);
+        trimGainDecibels.store(newValue);
     }
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout Pedal_iR_PrototyperAudioProcessor::createParameterLayout()
 {
     std::vector <std::unique_ptr<juce::RangedAudioParameter>> params;
-    params.reserve(3);
+    params.reserve(8);
     
     auto inputParam = std::make_unique<juce::AudioParameterFloat>(inputSliderId, inputSliderName, 0.0, 24.0, 24.0f);
     auto toneParam = std::make_unique<juce::AudioParameterFloat>(toneSliderId, toneSliderName, -12.0, 12.0, 0.0f);
     auto trimParam = std::make_unique<juce::AudioParameterFloat>(trimSliderId, trimSliderName, -24.0f, 24.0f, 0.0f);
+    auto convolutionModeParam = std::make_unique<juce::AudioParameterChoice>(convolutionModeId, convolutionModeName,
+                                                                             juce::StringArray {"Auto", "Zero Latency", "Low Latency", "Balanced", "Throughput"}, 0);
+    auto impulseResponseParam = std::make_unique<juce::AudioParameterChoice>(impulseResponseParamId, impulseResponseParamName,
+                                                                             juce::StringArray {"Overdrive", "Pedal At 12", "High Gain Low Drive", "User File"}, 0);
 
     params.push_back(std::move(inputParam));
     params.push_back(std::move(toneParam));
     params.push_back(std::move(trimParam));
+    params.push_back(std::move(convolutionModeParam));
+    params.push_back(std::move(impulseResponseParam));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(preFilterId, preFilterName,
+                                                                  juce::StringArray {"Off", "Mid Hump", "Tight", "Bright"}, 0));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(clippingId, clippingName,
+                                                                  juce::StringArray {"Tanh", "Soft Clip", "Hard Clip", "DC Bias"}, 0));
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(processingModeId, processingModeName,
+                                                                  juce::StringArray {"Independent", "Linked"}, 0));
     
     return { params.begin(), params.end() };
 }
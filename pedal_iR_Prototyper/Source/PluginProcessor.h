@@ -9,6 +9,12 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "PartitionedConvolver.h"
+#include "ImpulseResponseLoader.h"
+#include "../../ViatorDSP/LookupTableShaper.h"
+#include "../../ViatorDSP/ProcessorMeter.h"
+#include "../../ViatorDSP/ChannelGroupWorkers.h"
+#include "../../ViatorDSP/SilenceDetector.h"
 
 #define inputSliderId "input"
 #define inputSliderName "Input"
@@ -16,11 +22,21 @@
 #define toneSliderName "Tone"
 #define trimSliderId "trim"
 #define trimSliderName "Trim"
+#define convolutionModeId "convolutionMode"
+#define convolutionModeName "Convolution"
+#define impulseResponseParamId "impulseResponse"
+#define impulseResponseParamName "Impulse Response"
+#define preFilterId "preFilter"
+#define preFilterName "Pre EQ"
+#define clippingId "clipping"
+#define clippingName "Clipping"
+#define processingModeId "processingMode"
+#define processingModeName "Processing"
 
 //==============================================================================
 /**
 */
-class Pedal_iR_PrototyperAudioProcessor  : public juce::AudioProcessor, public juce::AudioProcessorValueTreeState::Listener
+class Pedal_iR_PrototyperAudioProcessor  : public juce::AudioProcessor, public juce::AudioProcessorValueTreeState::Listener, private juce::AsyncUpdater
 {
 public:
     //==============================================================================
@@ -60,22 +76,143 @@ public:
     void getStateInformation (juce::MemoryBlock& destData) override;
     void setStateInformation (const void* data, int sizeInBytes) override;
     void parameterChanged (const juce::String& parameterID, float newValue) override;
+    //Any thread, the audio thread picks the new gain up and glides the shelf over to it
     void updateToneFilter(const float &gain);
     
+    //Message thread, selects "User File" and loads it in the background
+    void loadUserImpulseResponse(const juce::File& file);
+    juce::File getUserImpulseResponse() const;
+    
     juce::AudioProcessorValueTreeState treeState;
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+    
+    //Block timing, read by the CSV log
+    ViatorDSP::ProcessorMeter meter;
+    
+    //Independent clips every channel on its own, linked clips them all by the loudest one
+    enum ProcessingMode
+    {
+        independentMode = 0,
+        linkedMode
+    };
+    
+    //Any layout up to this many channels, enough for 7.1.4 beds and 7th order ambisonics
+    static constexpr int maxBusChannels = 64;
 
 private:
     
-    float lastSampleRate{44100.0};
+    //Only when VIATOR_METER_LOG is set
+    std::unique_ptr<ViatorDSP::ProcessorMeterLogger> meterLogger;
+    
+    double lastSampleRate{44100.0};
+    
+    //Wiener-Hammerstein: a short pre EQ filter, the clipping curve, then the pedal IR.
+    //The stages around the convolver each make one pass per channel: input gain and the
+    //clipping before it, then the tone shelf, the second tanh and trim after it
+    void processPreFilter(juce::dsp::AudioBlock<float>& block) noexcept;
+    void processInputStage(juce::dsp::AudioBlock<float>& block) noexcept;
+    void processOutputStage(juce::dsp::AudioBlock<float>& block) noexcept;
+    
+    //Once the input has gone silent and the IR's tail has played out, whole blocks are
+    //skipped and skipSilentBlock only keeps the smoothers and convolver swaps in step
+    ViatorDSP::SilenceDetector silenceDetector;
+    void skipSilentBlock(int numSamples) noexcept;
+    
+    //DC Bias puts out an offset for silence, a new clipping choice is processed before skipping again
+    int lastClipping = -1;
+    
+    static constexpr double gainRampSeconds = 0.02;
+    
+    //Written by parameterChanged on whatever thread the host notifies on, the smoothers only
+    //take them on at the top of processBlock since SmoothedValue belongs to the audio thread
+    std::atomic<float> inputGainDecibels {0.0f};
+    std::atomic<float> trimGainDecibels {0.0f};
+    juce::SmoothedValue<float> inputGain;
+    juce::SmoothedValue<float> trimGain;
+    juce::AudioBuffer<float> gainRamp;
+    
+    //The output stage's tanh, anything past +-8 is flat anyway
+    ViatorDSP::LookupTableShaper<float> tanhTable;
+    
+    //One table per clipping choice, all built up front so switching is just an index
+    static constexpr int numClippingCurves = 4;
+    std::array<ViatorDSP::LookupTableShaper<float>, numClippingCurves> clippingTables;
+    
+    //Linked mode's loudest input and the gain it clips to, one sample index per entry
+    juce::AudioBuffer<float> linkBuffer;
+    
+    //One minimum phase filter per pre EQ voicing (null for Off), all on the zero latency layout. Bright
+    //stays under maxDirectFormLength and runs direct form. Tight (250 taps at 48 kHz, 700 at 192) never
+    //does and Mid Hump only does up to 48 kHz, past that they go through the partitioned path.
+    //A change fades from the old voicing to the new one
+    std::vector<std::unique_ptr<PartitionedConvolver>> preFilters;
+    int preFilterIndex = 0;
+    int fadingPreFilterIndex = -1;
+    
+    //Latency plus length of the longest voicing, how long the pre EQ can ring on after the input stops
+    int preFilterTail = 0;
+    juce::SmoothedValue<float> preFilterCrossfade;
+    
+    //Tone high shelf, transposed direct form II with two state values per channel.
+    //Only the shelf gain ever changes, so the coefficients come straight from the cookbook
+    //formula on the audio thread, every toneUpdateInterval samples while the gain glides
+    static constexpr double toneFrequency = 2020.0;
+    static constexpr double toneQ = 0.47;
+    static constexpr double toneRampSeconds = 0.05;
+    static constexpr size_t toneUpdateInterval = 32;
+    
+    void updateToneCoefficients(float gainDecibels) noexcept;
+    
+    std::atomic<float> toneGainDecibels {0.0f};
+    juce::SmoothedValue<float> toneGain;
+    
+    //b0, b1, b2, a1, a2, divided through by a0. toneCos and toneSin are of the shelf frequency
+    std::array<double, 5> toneCoefficients {1.0, 0.0, 0.0, 0.0, 0.0};
+    double toneCos = 0.0, toneSin = 0.0;
+    std::vector<std::array<float, 2>> toneState;
+    
+    //Set by the audio thread as it takes a convolver over, so the host hears of a new latency
+    //when the audio actually moves, and passed on from the message thread
+    std::atomic<int> convolverLatency {0};
+    std::atomic<int> impulseResponseLength {0};
+    std::atomic<bool> latencyChanged {false};
+    std::atomic<bool> convolverRequested {false};
+    
+    //Audio thread, straight after the swap
+    void publishConvolver() noexcept;
+    
+    //Changing the IR or the mode swaps convolvers, both run for this long while the new one fades in.
+    //Convolvers with different latencies would double up blended together, so between those the old
+    //one fades out over the first half and the new one in over the second
+    static constexpr double crossfadeSeconds = 0.03;
+    bool isLatencyFade = false;
+    
+    std::unique_ptr<PartitionedConvolver> convolver;
+    std::unique_ptr<PartitionedConvolver> fadingConvolver;
+    juce::AudioBuffer<float> fadingBuffer;
+    juce::AudioBuffer<float> crossfadeGains;
+    juce::SmoothedValue<float> crossfade;
+    
+    //The convolvers keep their state per pair of channels, on big layouts the pairs are spread
+    //over a few worker threads when rendering offline with blocks long enough to be worth waking them
+    static constexpr int channelsPerGroup = 2;
+    ViatorDSP::ChannelGroupWorkers convolutionWorkers;
+    
+    //The chunk the workers are on, set before each run
+    juce::dsp::AudioBlock<float> convolutionBlock, fadingConvolutionBlock;
+    void convolveGroup(int group) noexcept;
+    
+    int preparedBlockSize = 0;
     
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>> toneFilter;
+    //Decodes, resamples and partitions on its own thread through the process wide IR cache.
+    //Declared after everything its callback touches so it stops first
+    ImpulseResponseLoader impulseResponseLoader;
     
-    juce::dsp::Gain<float> inputProcessor;
-    juce::dsp::Convolution convolutionProcessor;
-    juce::dsp::WaveShaper<float> firstAtan;
-    juce::dsp::WaveShaper<float> secondAtan;
-    juce::dsp::Gain<float> trimProcessor;
+    //Auto (0) is zero latency when playing live and big partitions when rendering offline
+    PartitionedConvolver::Preset getConvolutionPreset() const;
+    ImpulseResponseLoader::Request createConvolverRequest(double sampleRate, int maximumBlockSize) const;
+    void processConvolution(juce::dsp::AudioBlock<float>& block) noexcept;
+    void handleAsyncUpdate() override;
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Pedal_iR_PrototyperAudioProcessor)
 };